@@ -26,6 +26,8 @@ void ci_lazy_methods_neededt::add_needed_method(
   const irep_idt &method_symbol_name)
 {
   callable_methods.insert(method_symbol_name);
+  if(recorded_methods != nullptr)
+    recorded_methods->insert(method_symbol_name);
 }
 
 /// For a given class id, note that its static initializer is needed.
@@ -51,6 +53,9 @@ void ci_lazy_methods_neededt::add_clinit_call(const irep_idt &class_id)
 bool ci_lazy_methods_neededt::add_needed_class(
   const irep_idt &class_symbol_name)
 {
+  if(recorded_classes != nullptr)
+    recorded_classes->insert(class_symbol_name);
+
   if(!instantiated_classes.insert(class_symbol_name).second)
     return false;
 
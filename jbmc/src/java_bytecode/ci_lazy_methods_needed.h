@@ -41,6 +41,17 @@ public:
 
   void add_all_needed_classes(const pointer_typet &pointer_type);
 
+  /// From now on, also add every method and class that is noted as needed to
+  /// \p methods and \p classes, even if it was needed already. Used to replay
+  /// the conversion of a method without converting it again.
+  void record_needed(
+    std::unordered_set<irep_idt> &methods,
+    std::unordered_set<irep_idt> &classes)
+  {
+    recorded_methods = &methods;
+    recorded_classes = &classes;
+  }
+
 private:
   // callable_methods is a vector because it's used as a work-list
   // which is periodically cleared. It can't be relied upon to
@@ -56,6 +67,9 @@ private:
 
   const select_pointer_typet &pointer_type_selector;
 
+  std::unordered_set<irep_idt> *recorded_methods = nullptr;
+  std::unordered_set<irep_idt> *recorded_classes = nullptr;
+
   void add_clinit_call(const irep_idt &class_id);
 
   void initialize_instantiated_classes_from_pointer(
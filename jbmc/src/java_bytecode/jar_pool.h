@@ -9,8 +9,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_JAVA_BYTECODE_JAR_POOL_H
 #define CPROVER_JAVA_BYTECODE_JAR_POOL_H
 
-#include <map>
 #include <string>
+#include <unordered_map>
 
 class jar_filet;
 
@@ -34,7 +34,7 @@ public:
 
 protected:
   /// Jar files that have been loaded
-  std::map<std::string, jar_filet> m_archives;
+  std::unordered_map<std::string, jar_filet> m_archives;
 };
 
 #endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_LOADER_H
@@ -1176,6 +1176,16 @@ java_bytecode_convert_methodt::convert_instructions(const methodt &method)
   // (these require the graph to determine live ranges)
   setup_local_variables(method, address_map);
 
+  // Addresses of exception handlers and of the starts of the ranges they
+  // cover, as these are looked up for every instruction below
+  std::set<std::size_t> exception_handler_pcs;
+  std::set<std::size_t> exception_start_pcs;
+  for(const auto &exception_row : method.exception_table)
+  {
+    exception_handler_pcs.insert(exception_row.handler_pc);
+    exception_start_pcs.insert(exception_row.start_pc);
+  }
+
   std::set<method_offsett> working_set;
 
   if(!instructions.empty())
@@ -1228,20 +1238,22 @@ java_bytecode_convert_methodt::convert_instructions(const methodt &method)
     // Find catch blocks that begin here. For now we assume if more than
     // one catch targets the same bytecode then we must be indifferent to
     // its type and just call it a Throwable.
-    auto it=method.exception_table.begin();
-    for(; it!=method.exception_table.end(); ++it)
+    if(exception_handler_pcs.count(cur_pc) != 0)
     {
-      if(cur_pc==it->handler_pc)
+      for(const auto &exception_row : method.exception_table)
       {
+        if(cur_pc != exception_row.handler_pc)
+          continue;
+
         if(
           catch_type != typet() ||
-          it->catch_type == struct_tag_typet(irep_idt()))
+          exception_row.catch_type == struct_tag_typet(irep_idt()))
         {
           catch_type = struct_tag_typet("java::java.lang.Throwable");
           break;
         }
         else
-          catch_type=it->catch_type;
+          catch_type = exception_row.catch_type;
       }
     }
 
@@ -1734,14 +1746,8 @@ java_bytecode_convert_methodt::convert_instructions(const methodt &method)
       CHECK_RETURN(a_it2 != address_map.end());
 
       // clear the stack if this is an exception handler
-      for(const auto &exception_row : method.exception_table)
-      {
-        if(address==exception_row.handler_pc)
-        {
-          stack.clear();
-          break;
-        }
-      }
+      if(exception_handler_pcs.count(address) != 0)
+        stack.clear();
 
       if(!stack.empty() && a_it2->second.predecessors.size()>1)
       {
@@ -1855,14 +1861,7 @@ java_bytecode_convert_methodt::convert_instructions(const methodt &method)
     // single try can be represented as multiple non-contiguous blocks in the
     // exception table.
     if(!start_new_block && has_seen_previous_address)
-    {
-      for(const auto &exception_row : method.exception_table)
-        if(exception_row.start_pc==previous_address)
-        {
-          start_new_block=true;
-          break;
-        }
-    }
+      start_new_block = exception_start_pcs.count(previous_address) != 0;
 
     if(start_new_block)
     {
@@ -2431,10 +2430,7 @@ codet &java_bytecode_convert_methodt::do_exception_handling(
   // block, i.e. the catch block. When there aren't any throwing statements in
   // the try block this block will not be the successor of any instruction.
 
-  auto next_opcode_it = std::find_if(
-    working_set.begin(),
-    working_set.end(),
-    [cur_pc](method_offsett offset) { return offset > cur_pc; });
+  auto next_opcode_it = working_set.upper_bound(cur_pc);
   if(next_opcode_it != working_set.end())
   {
     // Count the distinct start positions of handlers that end at this location
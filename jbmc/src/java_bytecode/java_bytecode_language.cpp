@@ -8,11 +8,16 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "java_bytecode_language.h"
 
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <sstream>
 #include <string>
 
 #include <util/cmdline.h>
 #include <util/config.h>
 #include <util/expr_iterator.h>
+#include <util/file_util.h>
 #include <util/invariant.h>
 #include <util/journalling_symbol_table.h>
 #include <util/options.h>
@@ -36,6 +41,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "java_bytecode_typecheck.h"
 #include "java_class_loader.h"
 #include "java_entry_point.h"
+#include "java_model_cache.h"
 #include "java_static_initializers.h"
 #include "java_string_literal_expr.h"
 #include "java_string_literals.h"
@@ -247,6 +253,44 @@ bool java_bytecode_languaget::parse(
   for(const auto &p : config.java.classpath)
     java_class_loader.add_classpath_entry(p);
 
+  if(library_cache != nullptr)
+  {
+    // The classes of the JAR files on the classpath make up the library,
+    // see java_library_cache_key
+    for(const auto &p : config.java.classpath)
+    {
+      if(!has_suffix(p, ".jar"))
+      {
+        user_class_directories.push_back(p);
+        continue;
+      }
+
+      try
+      {
+        for(const auto &file_name : java_class_loader.jar_pool(p).filenames())
+        {
+          if(has_suffix(file_name, ".class"))
+            library_classes.insert(
+              java_class_loadert::file_to_class_name(file_name));
+        }
+      }
+      catch(const std::runtime_error &)
+      {
+        // the class loader reports JAR files it cannot open
+      }
+    }
+
+    if(has_suffix(path, ".jar"))
+    {
+      for(const auto &file_name : java_class_loader.jar_pool(path).filenames())
+      {
+        if(has_suffix(file_name, ".class"))
+          library_classes.erase(
+            java_class_loadert::file_to_class_name(file_name));
+      }
+    }
+  }
+
   java_class_loader.set_message_handler(get_message_handler());
   java_class_loader.set_java_cp_include_files(java_cp_include_files);
   java_class_loader.add_load_classes(java_load_classes);
@@ -1221,7 +1265,58 @@ bool java_bytecode_languaget::convert_single_method(
 
   // No string solver or static init wrapper implementation;
   // check if have bytecode for it
-  if(cmb)
+  if(
+    cmb && library_cache != nullptr && needed_lazy_methods &&
+    is_library_class(cmb->get().class_id))
+  {
+    // The conversion of library methods is only cached when lazy methods
+    // are elaborated context-insensitively, as the methods and classes that
+    // it notes as needed are stored along with the body
+    const std::string settings = conversion_settings();
+    const auto needed =
+      library_cache->restore_method(function_id, settings, symbol_table);
+    if(needed.has_value())
+    {
+      for(const auto &method : needed->methods)
+        needed_lazy_methods->add_needed_method(method);
+      for(const auto &class_id : needed->classes)
+        needed_lazy_methods->add_needed_class(class_id);
+      return false;
+    }
+
+    java_library_cachet::neededt recorded;
+    needed_lazy_methods->record_needed(recorded.methods, recorded.classes);
+    journalling_symbol_tablet journal =
+      journalling_symbol_tablet::wrap(symbol_table);
+    java_bytecode_convert_method(
+      symbol_table.lookup_ref(cmb->get().class_id),
+      cmb->get().method,
+      journal,
+      get_message_handler(),
+      max_user_array_length,
+      throw_assertion_error,
+      std::move(needed_lazy_methods),
+      string_preprocess,
+      class_hierarchy,
+      threading_support);
+    INVARIANT(declaring_class(symbol), "Method must have a declaring class.");
+
+    // A conversion that changes symbols other than the method and those it
+    // introduces cannot be replayed from the cache
+    const bool only_inserted = std::all_of(
+      journal.get_updated().begin(),
+      journal.get_updated().end(),
+      [&](const irep_idt &id) {
+        return id == function_id || journal.get_inserted().count(id) != 0;
+      });
+    if(only_inserted && journal.get_removed().empty())
+    {
+      library_cache->store_method(
+        function_id, settings, symbol_table, journal.get_inserted(), recorded);
+    }
+    return false;
+  }
+  else if(cmb)
   {
     java_bytecode_convert_method(
       symbol_table.lookup_ref(cmb->get().class_id),
@@ -1262,6 +1357,41 @@ bool java_bytecode_languaget::convert_single_method(
   return true;
 }
 
+/// \param class_id: identifier of a class symbol
+/// \return true if the bytecode of the class can only come from the JAR
+///   files on the classpath, which the key of the library cache covers
+bool java_bytecode_languaget::is_library_class(const irep_idt &class_id) const
+{
+  const std::string class_name =
+    id2string(strip_java_namespace_prefix(class_id));
+  if(library_classes.count(class_name) == 0)
+    return false;
+
+  const std::string class_file =
+    java_class_loadert::class_name_to_os_file(class_name);
+  return std::none_of(
+    user_class_directories.begin(),
+    user_class_directories.end(),
+    [&](const std::string &directory) {
+      return std::ifstream(concat_dir_file(directory, class_file)).good();
+    });
+}
+
+/// \return a description of the options that change the body of a method
+///   converted from bytecode, or the classes it can refer to
+std::string java_bytecode_languaget::conversion_settings() const
+{
+  std::ostringstream settings;
+  settings << max_user_array_length << ' ' << throw_assertion_error << ' '
+           << threading_support << ' ' << string_refinement_enabled << ' '
+           << java_cp_include_files;
+  const std::set<std::string> sorted_no_load_classes(
+    no_load_classes.begin(), no_load_classes.end());
+  for(const auto &class_name : sorted_no_load_classes)
+    settings << ' ' << class_name;
+  return settings.str();
+}
+
 bool java_bytecode_languaget::final(symbol_table_baset &)
 {
   PRECONDITION(language_options_initialized);
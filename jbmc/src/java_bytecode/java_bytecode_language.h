@@ -35,6 +35,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(java-assume-inputs-non-null)" \
   "(java-assume-inputs-interval):" \
   "(java-assume-inputs-integral)" \
+  "(java-share-nondet-init)" \
   "(throw-runtime-exceptions)" \
   "(max-nondet-array-length):" \
   "(max-nondet-tree-depth):" \
@@ -70,6 +71,8 @@ Author: Daniel Kroening, kroening@kroening.com
   " --java-assume-inputs-integral\n" \
   "                              force float and double inputs to have integer values;\n" /* NOLINT(*) */ \
   "                              does not work for arrays;\n" /* NOLINT(*) */ \
+  " --java-share-nondet-init     initialize nondet objects of the same type and\n" /* NOLINT(*) */ \
+  "                              depth by calling one shared function\n" /* NOLINT(*) */ \
   " --java-max-vla-length N      limit the length of user-code-created arrays\n" /* NOLINT(*) */ \
   " --java-cp-include-files r    regexp or JSON list of files to load\n" \
   "                              (with '@' prefix)\n" \
@@ -106,6 +109,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "                              the file.\n"
 // clang-format on
 
+class java_library_cachet;
 class symbolt;
 
 enum lazy_methods_modet
@@ -122,6 +126,20 @@ class java_bytecode_languaget:public languaget
 public:
   void set_language_options(const optionst &) override;
 
+  /// Share the parse trees of class files with other languages using
+  /// \p cache, see \ref java_class_loadert::set_parse_tree_cache
+  void set_parse_tree_cache(java_class_loadert::parse_tree_cachet *cache)
+  {
+    java_class_loader.set_parse_tree_cache(cache);
+  }
+
+  /// Restore the bodies of methods of library classes from \p cache instead
+  /// of converting them, and add the ones that are converted to it
+  void set_library_cache(java_library_cachet *cache)
+  {
+    library_cache = cache;
+  }
+
   virtual bool preprocess(
     std::istream &instream,
     const std::string &path,
@@ -210,6 +228,8 @@ protected:
     optionalt<ci_lazy_methods_neededt> needed_lazy_methods);
 
   bool do_ci_lazy_method_conversion(symbol_tablet &);
+  bool is_library_class(const irep_idt &class_id) const;
+  std::string conversion_settings() const;
   const select_pointer_typet &get_pointer_type_selector() const;
 
   bool language_options_initialized;
@@ -261,6 +281,14 @@ private:
 
   /// If set, method bodies are only elaborated if they pass the filter
   optionalt<prefix_filtert> method_in_context;
+
+  /// Library methods converted by earlier runs, see \ref set_library_cache
+  java_library_cachet *library_cache = nullptr;
+  /// Classes found in the JAR files on the classpath but not in the input
+  /// file, which are library classes unless a directory on the classpath
+  /// provides them as well
+  std::unordered_set<irep_idt> library_classes;
+  std::vector<std::string> user_class_directories;
 };
 
 std::unique_ptr<languaget> new_java_bytecode_language();
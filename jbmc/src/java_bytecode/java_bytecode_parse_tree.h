@@ -21,9 +21,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 struct java_bytecode_parse_treet
 {
-  // Disallow copy construction and copy assignment, but allow move construction
-  // and move assignment.
-  java_bytecode_parse_treet(const java_bytecode_parse_treet &) = delete;
+  // Disallow implicit copy construction and copy assignment, but allow move
+  // construction and move assignment.
+  explicit java_bytecode_parse_treet(const java_bytecode_parse_treet &) =
+    default;
   java_bytecode_parse_treet &
   operator=(const java_bytecode_parse_treet &) = delete;
   java_bytecode_parse_treet(java_bytecode_parse_treet &&) = default;
@@ -202,9 +203,9 @@ struct java_bytecode_parse_treet
     {
     }
 
-    // Disallow copy construction and copy assignment, but allow move
+    // Disallow implicit copy construction and copy assignment, but allow move
     // construction and move assignment.
-    classt(const classt &) = delete;
+    explicit classt(const classt &) = default;
     classt &operator=(const classt &) = delete;
     classt(classt &&) = default;
     classt &operator=(classt &&) = default;
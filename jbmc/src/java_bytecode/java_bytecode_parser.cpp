@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <map>
 #include <string>
 
@@ -29,8 +30,11 @@ Author: Daniel Kroening, kroening@kroening.com
 class java_bytecode_parsert final : public parsert
 {
 public:
-  explicit java_bytecode_parsert(bool skip_instructions)
-    : skip_instructions(skip_instructions)
+  java_bytecode_parsert(
+    const char *data,
+    std::size_t size,
+    bool skip_instructions)
+    : skip_instructions(skip_instructions), position(data), end(data + size)
   {
   }
 
@@ -115,17 +119,18 @@ private:
   parse_method_handle(const class method_handle_infot &entry);
   void read_bootstrapmethods_entry(classt &);
 
+  /// The class file being parsed, and the next byte to read
+  const char *position = nullptr;
+  const char *end = nullptr;
+
   void skip_bytes(std::size_t bytes)
   {
-    for(std::size_t i=0; i<bytes; i++)
+    if(static_cast<std::size_t>(end - position) < bytes)
     {
-      if(!*in)
-      {
-        error() << "unexpected end of bytecode file" << eom;
-        throw 0;
-      }
-      in->get();
+      error() << "unexpected end of bytecode file" << eom;
+      throw 0;
     }
+    position += bytes;
   }
 
   template <typename T>
@@ -134,16 +139,16 @@ private:
     static_assert(
       std::is_unsigned<T>::value, "T should be an unsigned integer");
     const constexpr size_t bytes = sizeof(T);
+    if(static_cast<std::size_t>(end - position) < bytes)
+    {
+      error() << "unexpected end of bytecode file" << eom;
+      throw 0;
+    }
     u8 result = 0;
     for(size_t i = 0; i < bytes; i++)
     {
-      if(!*in)
-      {
-        error() << "unexpected end of bytecode file" << eom;
-        throw 0;
-      }
       result <<= 8;
-      result |= in->get();
+      result |= static_cast<unsigned char>(*position++);
     }
     return narrow_cast<T>(result);
   }
@@ -1820,14 +1825,13 @@ void java_bytecode_parsert::rmethod(classt &parsed_class)
     rmethod_attribute(method);
 }
 
-optionalt<java_bytecode_parse_treet>
-java_bytecode_parse(
-  std::istream &istream,
+optionalt<java_bytecode_parse_treet> java_bytecode_parse(
+  const char *data,
+  std::size_t size,
   message_handlert &message_handler,
   bool skip_instructions)
 {
-  java_bytecode_parsert java_bytecode_parser(skip_instructions);
-  java_bytecode_parser.in=&istream;
+  java_bytecode_parsert java_bytecode_parser(data, size, skip_instructions);
   java_bytecode_parser.set_message_handler(message_handler);
 
   bool parser_result=java_bytecode_parser.parse();
@@ -1840,6 +1844,20 @@ java_bytecode_parse(
   return std::move(java_bytecode_parser.parse_tree);
 }
 
+optionalt<java_bytecode_parse_treet>
+java_bytecode_parse(
+  std::istream &istream,
+  message_handlert &message_handler,
+  bool skip_instructions)
+{
+  const std::string class_file(
+    (std::istreambuf_iterator<char>(istream)),
+    std::istreambuf_iterator<char>());
+
+  return java_bytecode_parse(
+    class_file.data(), class_file.size(), message_handler, skip_instructions);
+}
+
 optionalt<java_bytecode_parse_treet>
 java_bytecode_parse(
   const std::string &file,
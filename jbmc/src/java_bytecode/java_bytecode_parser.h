@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_JAVA_BYTECODE_JAVA_BYTECODE_PARSER_H
 #define CPROVER_JAVA_BYTECODE_JAVA_BYTECODE_PARSER_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
 #include <util/optional.h>
@@ -28,6 +29,20 @@ java_bytecode_parse(
   class message_handlert &msg,
   bool skip_instructions = false);
 
+/// Attempt to parse a Java class from a class file held in memory. The bytes
+/// are read in place, so this avoids the copies made when parsing a stream.
+/// \param data: start of the class file
+/// \param size: size of the class file in bytes
+/// \param msg: handles log messages
+/// \param skip_instructions: if true, the loaded class's methods will all be
+///   empty. Saves time and memory for consumers that only want signature info.
+/// \return parse tree, or empty optionalt on failure
+optionalt<java_bytecode_parse_treet> java_bytecode_parse(
+  const char *data,
+  std::size_t size,
+  class message_handlert &msg,
+  bool skip_instructions = false);
+
 /// Attempt to parse a Java class from the given stream
 /// \param stream: stream to load from
 /// \param msg: handles log messages
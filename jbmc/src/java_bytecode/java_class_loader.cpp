@@ -8,9 +8,11 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "java_class_loader.h"
 
-#include <stack>
+#include <algorithm>
 #include <fstream>
+#include <stack>
 
+#include <util/invariant.h>
 #include <util/suffix.h>
 #include <util/prefix.h>
 
@@ -96,6 +98,86 @@ static bool is_overlay_class(const java_bytecode_parse_treet::classt &c)
     .has_value();
 }
 
+/// Check whether the class file \p class_file might contain an overlay class,
+/// without parsing it. The annotation marking overlay classes is referred to
+/// by its descriptor in the constant pool of any class carrying it.
+/// \param class_file: the contents of a class file
+/// \return false if the class is certainly not an overlay class
+static bool may_be_overlay_class(const std::string &class_file)
+{
+  static const std::string descriptor = [] {
+    // java::org.cprover.OverlayClassImplementation to
+    // Lorg/cprover/OverlayClassImplementation;
+    std::string name = id2string(ID_overlay_class).substr(6);
+    std::replace(name.begin(), name.end(), '.', '/');
+    return "L" + name + ";";
+  }();
+
+  return class_file.find(descriptor) != std::string::npos;
+}
+
+/// Read and parse the class file of \p class_name in \p cp_entry, using the
+/// parse tree cache if there is one.
+/// \param class_name: Name of class to load
+/// \param cp_entry: the classpath entry to load it from
+/// \param only_overlays: if true, skip the class unless it is an overlay
+///   class, avoiding parsing it where possible
+/// \return the parse tree, or an empty optional if the class file does not
+///   exist, cannot be parsed or is skipped
+optionalt<java_bytecode_parse_treet> java_class_loadert::load_class_file(
+  const irep_idt &class_name,
+  const classpath_entryt &cp_entry,
+  bool only_overlays)
+{
+  if(parse_tree_cache != nullptr)
+  {
+    const auto entry =
+      parse_tree_cache->parse_trees.find({cp_entry.path, class_name});
+    if(entry != parse_tree_cache->parse_trees.end())
+    {
+      if(!entry->second.has_value())
+        return {};
+
+      if(only_overlays && !is_overlay_class(entry->second->parsed_class))
+      {
+        warning()
+          << "Skipping duplicate definition of class " << class_name
+          << " not marked with OverlayClassImplementation" << eom;
+        return {};
+      }
+
+      return java_bytecode_parse_treet(*entry->second);
+    }
+  }
+
+  const auto class_file = read_class_file(class_name, cp_entry);
+
+  // Checking for the annotation is much cheaper than parsing. Classes skipped
+  // this way are not cached, as they may be needed by other class loaders.
+  if(
+    only_overlays && class_file.has_value() &&
+    !may_be_overlay_class(*class_file))
+  {
+    warning()
+      << "Skipping duplicate definition of class " << class_name
+      << " not marked with OverlayClassImplementation" << eom;
+    return {};
+  }
+
+  optionalt<java_bytecode_parse_treet> parse_tree;
+  if(class_file.has_value())
+    parse_tree = parse_class_file(*class_file);
+
+  if(parse_tree_cache != nullptr)
+  {
+    auto &cached = parse_tree_cache->parse_trees[{cp_entry.path, class_name}];
+    if(parse_tree.has_value())
+      cached = java_bytecode_parse_treet(*parse_tree);
+  }
+
+  return parse_tree;
+}
+
 /// Check through all the places class parse trees can appear and returns the
 /// first implementation it finds plus any overlay class implementations.
 /// Uses \p class_loader_limit to limit the class files that it might (directly
@@ -125,11 +207,23 @@ java_class_loadert::get_parse_tree(
   }
 
   // Rummage through the class path
+  bool found_underlying_class = false;
   for(const auto &cp_entry : classpath_entries)
   {
-    auto parse_tree = load_class(class_name, cp_entry);
-    if(parse_tree.has_value())
-      parse_trees.emplace_back(std::move(*parse_tree));
+    // Later definitions are only kept if they are overlays
+    auto parse_tree =
+      load_class_file(class_name, cp_entry, found_underlying_class);
+    if(!parse_tree.has_value())
+      continue;
+
+    if(
+      parse_tree->loading_successful &&
+      !is_overlay_class(parse_tree->parsed_class))
+    {
+      found_underlying_class = true;
+    }
+
+    parse_trees.emplace_back(std::move(*parse_tree));
   }
 
   auto parse_tree_it = parse_trees.begin();
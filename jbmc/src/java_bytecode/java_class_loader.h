@@ -37,6 +37,20 @@ public:
   typedef std::function<std::vector<irep_idt>(const irep_idt &)>
     get_extra_class_refs_functiont;
 
+  /// Parse trees that can be shared by several class loaders, such that
+  /// class files found by all of them, for example when verifying several
+  /// entry points in one run, are only read and parsed once. The class files
+  /// must not change while the cache is in use.
+  struct parse_tree_cachet
+  {
+    /// Parse trees by classpath entry and class name. An empty optional
+    /// records that the entry has no class file for the class that parses.
+    std::map<
+      std::pair<std::string, irep_idt>,
+      optionalt<java_bytecode_parse_treet>>
+      parse_trees;
+  };
+
   java_class_loadert()
   {
   }
@@ -53,6 +67,13 @@ public:
   {
     java_cp_include_files = cp_include_files;
   }
+  /// Use \p cache to look up parse trees before reading class files, and to
+  /// store the parse trees read. The cache must outlive the class loader.
+  /// \param cache: the cache, or null to not use one
+  void set_parse_tree_cache(parse_tree_cachet *cache)
+  {
+    parse_tree_cache = cache;
+  }
   /// Sets a function that provides extra dependencies for a particular class.
   /// Currently used by the string preprocessor to note that even if we don't
   /// have a definition of core string types, it will nontheless give them
@@ -99,7 +120,15 @@ private:
   /// Map from class names to the bytecode parse trees
   parse_tree_with_overridest_mapt class_map;
 
+  /// Parse trees shared with other class loaders, if any
+  parse_tree_cachet *parse_tree_cache = nullptr;
+
   optionalt<std::vector<irep_idt>> read_jar_file(const std::string &jar_path);
+
+  optionalt<java_bytecode_parse_treet> load_class_file(
+    const irep_idt &class_name,
+    const classpath_entryt &cp_entry,
+    bool only_overlays);
 };
 
 #endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_LOADER_H
@@ -16,6 +16,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/suffix.h>
 
 #include <fstream>
+#include <iterator>
 
 void java_class_loader_baset::add_classpath_entry(const std::string &path)
 {
@@ -112,25 +113,46 @@ java_class_loader_baset::class_name_to_os_file(const irep_idt &class_name)
 optionalt<java_bytecode_parse_treet> java_class_loader_baset::load_class(
   const irep_idt &class_name,
   const classpath_entryt &cp_entry)
+{
+  const auto class_file = read_class_file(class_name, cp_entry);
+  if(!class_file.has_value())
+    return {};
+
+  return parse_class_file(*class_file);
+}
+
+/// attempt to read the class file of a class from a classpath_entry
+optionalt<std::string> java_class_loader_baset::read_class_file(
+  const irep_idt &class_name,
+  const classpath_entryt &cp_entry)
 {
   switch(cp_entry.kind)
   {
   case classpath_entryt::JAR:
-    return get_class_from_jar(class_name, cp_entry.path);
+    return get_class_file_from_jar(class_name, cp_entry.path);
 
   case classpath_entryt::DIRECTORY:
-    return get_class_from_directory(class_name, cp_entry.path);
+    return get_class_file_from_directory(class_name, cp_entry.path);
   }
 
   UNREACHABLE;
 }
 
-/// Load class from jar file.
+/// Parse the contents of a class file.
+/// \param class_file: the bytes of the class file
+/// \return optional value of parse tree, empty if class cannot be parsed
+optionalt<java_bytecode_parse_treet>
+java_class_loader_baset::parse_class_file(const std::string &class_file)
+{
+  return java_bytecode_parse(
+    class_file.data(), class_file.size(), get_message_handler());
+}
+
+/// Read class file from jar file.
 /// \param class_name: name of class to load in Java source format
 /// \param jar_file: path of the jar file
-/// \return optional value of parse tree, empty if class cannot be loaded
-optionalt<java_bytecode_parse_treet>
-java_class_loader_baset::get_class_from_jar(
+/// \return optional contents of the class file, empty if class cannot be found
+optionalt<std::string> java_class_loader_baset::get_class_file_from_jar(
   const irep_idt &class_name,
   const std::string &jar_file)
 {
@@ -138,15 +160,12 @@ java_class_loader_baset::get_class_from_jar(
   {
     auto &jar = jar_pool(jar_file);
     auto data = jar.get_entry(class_name_to_jar_file(class_name));
-
     if(!data.has_value())
       return {};
 
     debug() << "Getting class '" << class_name << "' from JAR " << jar_file
             << eom;
-
-    std::istringstream istream(*data);
-    return java_bytecode_parse(istream, get_message_handler());
+    return data;
   }
   catch(const std::runtime_error &)
   {
@@ -155,12 +174,11 @@ java_class_loader_baset::get_class_from_jar(
   }
 }
 
-/// Load class from directory.
+/// Read class file from directory.
 /// \param class_name: name of class to load in Java source format
 /// \param path: directory to load from
-/// \return optional value of parse tree, empty if class cannot be loaded
-optionalt<java_bytecode_parse_treet>
-java_class_loader_baset::get_class_from_directory(
+/// \return optional contents of the class file, empty if class cannot be found
+optionalt<std::string> java_class_loader_baset::get_class_file_from_directory(
   const irep_idt &class_name,
   const std::string &path)
 {
@@ -168,12 +186,12 @@ java_class_loader_baset::get_class_from_directory(
   const std::string class_file = class_name_to_os_file(class_name);
   const std::string full_path = concat_dir_file(path, class_file);
 
-  if(std::ifstream(full_path))
-  {
-    debug() << "Getting class '" << class_name << "' from file " << full_path
-            << eom;
-    return java_bytecode_parse(full_path, get_message_handler());
-  }
-  else
+  std::ifstream in(full_path, std::ios::binary);
+  if(!in)
     return {};
+
+  debug() << "Getting class '" << class_name << "' from file " << full_path
+          << eom;
+  return std::string(
+    std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
 }
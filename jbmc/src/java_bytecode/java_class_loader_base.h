@@ -58,13 +58,22 @@ protected:
   optionalt<java_bytecode_parse_treet>
   load_class(const irep_idt &class_name, const classpath_entryt &);
 
-  /// attempt to load a class from a given jar file
-  optionalt<java_bytecode_parse_treet>
-  get_class_from_jar(const irep_idt &class_name, const std::string &jar_file);
+  /// attempt to read the class file of a class from a classpath_entry
+  optionalt<std::string>
+  read_class_file(const irep_idt &class_name, const classpath_entryt &);
 
-  /// attempt to load a class from a given directory
+  /// parse the contents of a class file
   optionalt<java_bytecode_parse_treet>
-  get_class_from_directory(const irep_idt &class_name, const std::string &path);
+  parse_class_file(const std::string &class_file);
+
+  /// attempt to read the class file of a class from a given jar file
+  optionalt<std::string>
+  get_class_file_from_jar(const irep_idt &class_name, const std::string &jar);
+
+  /// attempt to read the class file of a class from a given directory
+  optionalt<std::string> get_class_file_from_directory(
+    const irep_idt &class_name,
+    const std::string &path);
 };
 
 #endif // CPROVER_JAVA_BYTECODE_JAVA_CLASS_LOADER_BASE_H
@@ -0,0 +1,272 @@
+/*******************************************************************\
+
+Module: Cache of converted Java library methods
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of the Java library methods converted by earlier runs, keyed by the
+/// contents of the JAR files on the classpath
+
+#include "java_model_cache.h"
+
+#include <util/file_util.h>
+#include <util/find_symbols.h>
+#include <util/message.h>
+#include <util/suffix.h>
+#include <util/version.h>
+
+#include <goto-programs/goto_model.h>
+#include <goto-programs/read_goto_binary.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+/// 64-bit FNV-1a hash of the JAR files the library methods are converted from
+class input_hasht
+{
+public:
+  void add(const char *data, std::size_t size)
+  {
+    for(std::size_t i = 0; i < size; ++i)
+    {
+      value ^= static_cast<unsigned char>(data[i]);
+      value *= 1099511628211u;
+    }
+  }
+
+  /// Add \p s followed by a separator, so that consecutive strings cannot
+  /// run into each other
+  void add(const std::string &s)
+  {
+    add(s.c_str(), s.size() + 1);
+  }
+
+  /// Add the contents of the file \p path
+  /// \return true if the file cannot be read
+  bool add_file(const std::string &path)
+  {
+    std::ifstream in(path, std::ios::binary);
+    if(!in)
+      return true;
+
+    char buffer[1 << 16];
+    while(in)
+    {
+      in.read(buffer, sizeof(buffer));
+      add(buffer, static_cast<std::size_t>(in.gcount()));
+    }
+
+    return in.bad();
+  }
+
+  std::string str() const
+  {
+    std::ostringstream result;
+    result << std::hex << std::setw(16) << std::setfill('0') << value;
+    return result.str();
+  }
+
+private:
+  uint64_t value = 14695981039346656037u;
+};
+} // namespace
+
+optionalt<std::string> java_library_cache_key(
+  const std::list<std::string> &classpath,
+  message_handlert &message_handler)
+{
+  messaget log(message_handler);
+  input_hasht hash;
+
+  hash.add(CBMC_VERSION);
+
+  for(const auto &entry : classpath)
+  {
+    if(!has_suffix(entry, ".jar"))
+      continue;
+
+    // the order of the JAR files decides which definition of a class is used
+    if(hash.add_file(entry))
+    {
+      log.warning() << "not using the model cache: cannot read '" << entry
+                    << "'" << messaget::eom;
+      return {};
+    }
+  }
+
+  return hash.str();
+}
+
+/// Name of the snapshot symbol that records how \p function_id was converted
+static irep_idt record_name(const irep_idt &function_id)
+{
+  return "java_library_cache::" + id2string(function_id);
+}
+
+static void add_ids(
+  irept &record,
+  const irep_idt &name,
+  const std::unordered_set<irep_idt> &ids)
+{
+  irept::subt &sub = record.add(name).get_sub();
+  for(const auto &id : ids)
+    sub.emplace_back(id);
+}
+
+static std::unordered_set<irep_idt>
+get_ids(const irept &record, const irep_idt &name)
+{
+  std::unordered_set<irep_idt> result;
+  for(const auto &id : record.find(name).get_sub())
+    result.insert(id.id());
+  return result;
+}
+
+void java_library_cachet::read(message_handlert &message_handler)
+{
+  messaget log(message_handler);
+  const std::string file_name = concat_dir_file(cache_dir, key + ".gb");
+
+  if(!std::ifstream(file_name))
+  {
+    log.status() << "Model cache miss for " << key << messaget::eom;
+    return;
+  }
+
+  log.status() << "Reading library methods from cache '" << file_name << "'"
+               << messaget::eom;
+
+  auto goto_model = read_goto_binary(file_name, message_handler);
+  if(!goto_model.has_value())
+  {
+    log.warning() << "ignoring unreadable model cache entry '" << file_name
+                  << "'" << messaget::eom;
+    return;
+  }
+
+  snapshot.swap(goto_model->symbol_table);
+}
+
+void java_library_cachet::write(message_handlert &message_handler) const
+{
+  if(!modified)
+    return;
+
+  messaget log(message_handler);
+
+  if(!is_directory(cache_dir) && !create_directory(cache_dir))
+  {
+    log.warning() << "failed to create model cache directory '" << cache_dir
+                  << "'" << messaget::eom;
+    return;
+  }
+
+  // write to a temporary file first so that concurrent runs never read a
+  // partially written snapshot
+  const std::string file_name = concat_dir_file(cache_dir, key + ".gb");
+  const std::string temporary_file_name = file_name + ".tmp";
+
+  bool error;
+  {
+    std::ofstream out(temporary_file_name, std::ios::binary);
+    error = !out || write_goto_binary(out, snapshot, goto_functionst{});
+  }
+
+  if(
+    error ||
+    std::rename(temporary_file_name.c_str(), file_name.c_str()) != 0)
+  {
+    log.warning() << "failed to write model cache entry '" << file_name << "'"
+                  << messaget::eom;
+    std::remove(temporary_file_name.c_str());
+    return;
+  }
+
+  log.status() << "Stored library methods in cache '" << file_name << "'"
+               << messaget::eom;
+}
+
+optionalt<java_library_cachet::neededt> java_library_cachet::restore_method(
+  const irep_idt &function_id,
+  const std::string &settings,
+  symbol_table_baset &symbol_table) const
+{
+  const symbolt *record = snapshot.lookup(record_name(function_id));
+  const symbolt *method = snapshot.lookup(function_id);
+  if(
+    record == nullptr || method == nullptr ||
+    record->value.get(ID_value) != settings)
+  {
+    return {};
+  }
+
+  const std::unordered_set<irep_idt> inserted =
+    get_ids(record->value, "inserted");
+  neededt needed{get_ids(record->value, "needed_methods"),
+                 get_ids(record->value, "needed_classes")};
+
+  // Everything the body refers to must exist in this run as well, as the
+  // classes loaded depend on the user classes
+  find_symbols_sett referenced;
+  find_type_and_expr_symbols(method->type, referenced);
+  find_type_and_expr_symbols(method->value, referenced);
+  for(const auto &id : inserted)
+  {
+    const symbolt *symbol = snapshot.lookup(id);
+    if(symbol == nullptr)
+      return {};
+    find_type_and_expr_symbols(symbol->type, referenced);
+    find_type_and_expr_symbols(symbol->value, referenced);
+  }
+  referenced.insert(needed.methods.begin(), needed.methods.end());
+  referenced.insert(needed.classes.begin(), needed.classes.end());
+  for(const auto &id : referenced)
+  {
+    if(inserted.count(id) == 0 && !symbol_table.has_symbol(id))
+      return {};
+  }
+
+  // Symbols introduced by converting the method may already have been
+  // introduced by another one, in which case they are left as they are
+  for(const auto &id : inserted)
+    symbol_table.insert(*snapshot.lookup(id));
+  symbol_table.get_writeable_ref(function_id) = *method;
+
+  return needed;
+}
+
+void java_library_cachet::store_method(
+  const irep_idt &function_id,
+  const std::string &settings,
+  const symbol_table_baset &symbol_table,
+  const std::unordered_set<irep_idt> &inserted,
+  const neededt &needed)
+{
+  symbolt record;
+  record.name = record_name(function_id);
+  record.mode = ID_java;
+  record.type = empty_typet();
+  record.value = exprt("java_library_cache_record");
+  record.value.set(ID_value, settings);
+  add_ids(record.value, "inserted", inserted);
+  add_ids(record.value, "needed_methods", needed.methods);
+  add_ids(record.value, "needed_classes", needed.classes);
+
+  snapshot.insert(symbol_table.lookup_ref(function_id)).first =
+    symbol_table.lookup_ref(function_id);
+  for(const auto &id : inserted)
+    snapshot.insert(symbol_table.lookup_ref(id)).first =
+      symbol_table.lookup_ref(id);
+  snapshot.insert(record).first = record;
+
+  modified = true;
+}
@@ -0,0 +1,106 @@
+/*******************************************************************\
+
+Module: Cache of converted Java library methods
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of the Java library methods converted by earlier runs, keyed by the
+/// contents of the JAR files on the classpath
+
+#ifndef CPROVER_JAVA_BYTECODE_JAVA_MODEL_CACHE_H
+#define CPROVER_JAVA_BYTECODE_JAVA_MODEL_CACHE_H
+
+#include <util/irep.h>
+#include <util/optional.h>
+#include <util/symbol_table.h>
+
+#include <list>
+#include <string>
+#include <unordered_set>
+
+class message_handlert;
+
+// clang-format off
+#define OPT_JAVA_MODEL_CACHE /*NOLINT*/ \
+  "(java-model-cache):" \
+
+#define HELP_JAVA_MODEL_CACHE /*NOLINT*/ \
+    " --java-model-cache dir       reuse the library methods stored in dir by earlier\n" /*NOLINT*/ \
+    "                              runs with the same JAR files on the classpath\n" /*NOLINT*/ \
+// clang-format on
+
+/// Compute the key under which the library methods for \p classpath are
+/// cached: the tool version and the contents of the JAR files on it.
+/// Directories on the classpath and the input file hold the user classes,
+/// which are converted on every run, so they are not part of the key.
+/// \param classpath: the classpath of the current run
+/// \param message_handler: for diagnostics
+/// \return the key, or an empty optional if a JAR file cannot be read
+optionalt<std::string> java_library_cache_key(
+  const std::list<std::string> &classpath,
+  message_handlert &message_handler);
+
+/// The bodies of methods of library classes, that is classes that are only
+/// found in the JAR files of the key, as converted from bytecode by earlier
+/// runs, together with the symbols their conversion introduced. The user
+/// classes of a run are converted on top of the library methods restored
+/// from the cache. A method converted with different settings, or whose
+/// body refers to symbols that the current run lacks, is converted again.
+class java_library_cachet
+{
+public:
+  java_library_cachet(std::string cache_dir, std::string key)
+    : cache_dir(std::move(cache_dir)), key(std::move(key))
+  {
+  }
+
+  /// Read the library methods stored under the key, if there are any
+  void read(message_handlert &message_handler);
+
+  /// Store the library methods under the key if methods have been added
+  /// since they were read. Failures are reported as warnings, as the cache
+  /// only serves to speed up later runs.
+  void write(message_handlert &message_handler) const;
+
+  /// The methods and classes that \ref ci_lazy_methodst was told it needs
+  /// while a method was converted
+  struct neededt
+  {
+    std::unordered_set<irep_idt> methods;
+    std::unordered_set<irep_idt> classes;
+  };
+
+  /// Copy the body of \p function_id, converted under \p settings, and the
+  /// symbols its conversion introduced into \p symbol_table
+  /// \return the methods and classes needed by the body, or an empty optional
+  ///   if there is no such body or it refers to symbols that are missing from
+  ///   \p symbol_table
+  optionalt<neededt> restore_method(
+    const irep_idt &function_id,
+    const std::string &settings,
+    symbol_table_baset &symbol_table) const;
+
+  /// Add the body of \p function_id, converted under \p settings, and the
+  /// symbols \p inserted by its conversion, taken from \p symbol_table
+  void store_method(
+    const irep_idt &function_id,
+    const std::string &settings,
+    const symbol_table_baset &symbol_table,
+    const std::unordered_set<irep_idt> &inserted,
+    const neededt &needed);
+
+private:
+  const std::string cache_dir;
+  const std::string key;
+
+  /// The converted methods, the symbols their conversion introduced and for
+  /// each method a record of the settings, the introduced symbols and the
+  /// needed methods and classes
+  symbol_tablet snapshot;
+  bool modified = false;
+};
+
+#endif // CPROVER_JAVA_BYTECODE_JAVA_MODEL_CACHE_H
@@ -10,6 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/array_element_from_pointer.h>
 #include <util/expr_initializer.h>
+#include <util/fresh_symbol.h>
 #include <util/nondet.h>
 #include <util/nondet_bool.h>
 #include <util/pointer_offset_size.h>
@@ -24,6 +25,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "java_string_literals.h"
 #include "java_utils.h"
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <tuple>
+
 class java_object_factoryt
 {
   const java_object_factory_parameterst object_factory_parameters;
@@ -57,6 +63,17 @@ class java_object_factoryt
   /// Log for reporting warnings and errors in object creation
   messaget log;
 
+  /// Struct tag, tree depth and sorted recursion set for which a shared
+  /// initialization function was generated; together with the factory
+  /// parameters these determine the code in the function body.
+  using shared_init_keyt =
+    std::tuple<irep_idt, std::size_t, std::vector<irep_idt>>;
+
+  /// Functions generated when the parameter `share_nondet_init_functions` is
+  /// set, shared with the factories that generate their bodies
+  std::shared_ptr<std::map<shared_init_keyt, irep_idt>> shared_init_functions =
+    std::make_shared<std::map<shared_init_keyt, irep_idt>>();
+
   void gen_pointer_target_init(
     code_blockt &assignments,
     const exprt &expr,
@@ -65,6 +82,18 @@ class java_object_factoryt
     size_t depth,
     update_in_placet update_in_place,
     const source_locationt &location);
+
+  bool can_share_init_function(
+    const exprt &expr,
+    const pointer_typet &pointer_type,
+    lifetimet lifetime) const;
+
+  code_function_callt gen_shared_pointer_target_init(
+    const exprt &expr,
+    const pointer_typet &pointer_type,
+    size_t depth,
+    const source_locationt &location);
+
 public:
   java_object_factoryt(
     const source_locationt &loc,
@@ -258,6 +287,124 @@ void java_object_factoryt::gen_pointer_target_init(
     location);
 }
 
+/// Whether the object that \p expr is set to point to can be allocated and
+/// initialized by a shared function, see \ref gen_shared_pointer_target_init.
+/// This requires objects that outlive the function (DYNAMIC lifetime) and a
+/// class whose initialization does not depend on the generic parameter
+/// specializations of the enclosing scope. Arrays and enums are always
+/// initialized inline.
+bool java_object_factoryt::can_share_init_function(
+  const exprt &expr,
+  const pointer_typet &pointer_type,
+  lifetimet lifetime) const
+{
+  if(
+    !object_factory_parameters.share_nondet_init_functions ||
+    lifetime != lifetimet::DYNAMIC || expr.type() != pointer_type ||
+    is_java_generic_type(pointer_type))
+  {
+    return false;
+  }
+
+  const namespacet ns(symbol_table);
+  const auto &class_type =
+    to_java_class_type(ns.follow(pointer_type.subtype()));
+  return !has_prefix(id2string(class_type.get_tag()), "java::array[") &&
+         !class_type.get_base("java::java.lang.Enum") &&
+         !is_java_generic_class_type(class_type) &&
+         !is_java_implicitly_generic_class_type(class_type);
+}
+
+/// Emits `<expr> = f();` instead of the code emitted by
+/// gen_pointer_target_init in NO_UPDATE_IN_PLACE mode. The function `f`
+/// allocates a new object of type `pointer_type.subtype()` and
+/// nondet-initializes it; it is generated on first use and shared by every
+/// object of the same type that is reached at the same \p depth with the same
+/// recursion set, so that the initialization code of a type occurs once
+/// rather than once per field of that type in the object tree.
+/// The depth is part of the key rather than a parameter of `f`: whether a
+/// pointer may be null or must be cut off is decided while generating code,
+/// and classes initialized inline, such as arrays and generic classes, can
+/// only be unfolded a bounded number of times at a known depth.
+/// \param expr: Pointer-typed lvalue expression to initialize
+/// \param pointer_type: The type of \p expr
+/// \param depth: Number of times that a pointer has been dereferenced from the
+///   root of the object tree that we are initializing
+/// \param location: Source location associated with nondet-initialization
+/// \return The call to the shared function
+code_function_callt java_object_factoryt::gen_shared_pointer_target_init(
+  const exprt &expr,
+  const pointer_typet &pointer_type,
+  size_t depth,
+  const source_locationt &location)
+{
+  const namespacet ns(symbol_table);
+  const auto &class_type =
+    to_java_class_type(ns.follow(pointer_type.subtype()));
+
+  std::vector<irep_idt> recursion_tags(
+    recursion_set.begin(), recursion_set.end());
+  std::sort(recursion_tags.begin(), recursion_tags.end());
+  shared_init_keyt key{class_type.get_tag(), depth, std::move(recursion_tags)};
+
+  const auto existing = shared_init_functions->find(key);
+  if(existing != shared_init_functions->end())
+  {
+    const symbolt &function_symbol = symbol_table.lookup_ref(existing->second);
+    return code_function_callt{expr, function_symbol.symbol_expr(), {}};
+  }
+
+  const irep_idt class_name =
+    strip_java_namespace_prefix(class_type.get_name());
+  symbolt &new_symbol = get_fresh_aux_symbol(
+    java_method_typet{{}, pointer_type},
+    id2string(object_factory_parameters.function_id),
+    "nondet_init_" + id2string(class_name),
+    location,
+    ID_java,
+    symbol_table);
+  new_symbol.is_lvalue = false;
+  new_symbol.is_state_var = false;
+  new_symbol.is_thread_local = false;
+  const irep_idt function_id = new_symbol.name;
+  const symbol_exprt function_expr = new_symbol.symbol_expr();
+
+  // The body is generated by a factory of its own, so that the objects it
+  // creates are locals of the new function
+  java_object_factory_parameterst parameters = object_factory_parameters;
+  parameters.function_id = function_id;
+  java_object_factoryt function_factory(
+    location,
+    parameters,
+    symbol_table,
+    pointer_type_selector,
+    log.get_message_handler());
+  function_factory.recursion_set = recursion_set;
+  function_factory.shared_init_functions = shared_init_functions;
+
+  const symbol_exprt result =
+    function_factory.allocate_objects.allocate_automatic_local_object(
+      pointer_type, "nondet_init_result");
+  code_blockt assignments;
+  function_factory.gen_pointer_target_init(
+    assignments,
+    result,
+    pointer_type.subtype(),
+    lifetimet::DYNAMIC,
+    depth,
+    update_in_placet::NO_UPDATE_IN_PLACE,
+    location);
+
+  code_blockt body;
+  function_factory.declare_created_symbols(body);
+  body.append(assignments);
+  body.add(code_returnt{result});
+  symbol_table.get_writeable_ref(function_id).value = std::move(body);
+
+  shared_init_functions->emplace(std::move(key), function_id);
+  return code_function_callt{expr, function_expr, {}};
+}
+
 /// Recursion-set entry owner class. If a recursion-set entry is added
 /// in a particular scope, ensures that it is erased on leaving
 /// that scope.
@@ -602,14 +749,22 @@ void java_object_factoryt::gen_nondet_pointer_init(
   // and asign to `expr` the address of such object
   code_blockt non_null_inst;
 
-  gen_pointer_target_init(
-    non_null_inst,
-    expr,
-    subtype,
-    lifetime,
-    depth,
-    update_in_placet::NO_UPDATE_IN_PLACE,
-    location);
+  if(can_share_init_function(expr, pointer_type, lifetime))
+  {
+    non_null_inst.add(
+      gen_shared_pointer_target_init(expr, pointer_type, depth, location));
+  }
+  else
+  {
+    gen_pointer_target_init(
+      non_null_inst,
+      expr,
+      subtype,
+      lifetime,
+      depth,
+      update_in_placet::NO_UPDATE_IN_PLACE,
+      location);
+  }
 
   const code_assignt set_null_inst{
     expr, null_pointer_exprt{pointer_type}, location};
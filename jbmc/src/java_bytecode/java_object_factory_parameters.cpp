@@ -48,6 +48,7 @@ void java_object_factory_parameterst::set(const optionst &options)
     }();
   }
   assume_inputs_integral = options.is_set("java-assume-inputs-integral");
+  share_nondet_init_functions = options.is_set("java-share-nondet-init");
 }
 
 void parse_java_object_factory_options(
@@ -66,4 +67,8 @@ void parse_java_object_factory_options(
   {
     options.set_option("java-assume-inputs-integral", true);
   }
+  if(cmdline.isset("java-share-nondet-init"))
+  {
+    options.set_option("java-share-nondet-init", true);
+  }
 }
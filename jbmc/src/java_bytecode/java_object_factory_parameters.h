@@ -28,6 +28,11 @@ struct java_object_factory_parameterst final : public object_factory_parameterst
   /// Force double and float inputs to be integral
   bool assume_inputs_integral;
 
+  /// Initialize each nondet object in a function that is shared by all
+  /// objects of the same type, tree depth and recursion set, rather than
+  /// inlining the initialization at every place such an object is reached
+  bool share_nondet_init_functions = false;
+
   /// Assigns the parameters from given options
   void set(const optionst &);
 };
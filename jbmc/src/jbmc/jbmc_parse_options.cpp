@@ -63,11 +63,13 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <java_bytecode/convert_java_nondet.h>
 #include <java_bytecode/java_bytecode_language.h>
+#include <java_bytecode/java_class_loader.h>
 #include <java_bytecode/java_enum_static_init_unwind_handler.h>
 #include <java_bytecode/java_multi_path_symex_checker.h>
 #include <java_bytecode/java_multi_path_symex_only_checker.h>
 #include <java_bytecode/java_single_path_symex_checker.h>
 #include <java_bytecode/java_single_path_symex_only_checker.h>
+#include <java_bytecode/java_utils.h>
 #include <java_bytecode/remove_exceptions.h>
 #include <java_bytecode/remove_instanceof.h>
 #include <java_bytecode/remove_java_new.h>
@@ -548,11 +550,82 @@ int jbmc_parse_optionst::doit()
     return CPROVER_EXIT_INCORRECT_TASK;
   }
 
+  if(cmdline.get_values("function").size() > 1)
+    return verify_entry_points(options);
+
   std::unique_ptr<abstract_goto_modelt> goto_model_ptr;
   int get_goto_program_ret = get_goto_program(goto_model_ptr, options);
   if(get_goto_program_ret != -1)
     return get_goto_program_ret;
 
+  return verify(options, *goto_model_ptr);
+}
+
+/// Verify each entry point given by a `--function` option in turn. Class
+/// files are only read and parsed once for all of them.
+/// \param options: the options, with `function` set to each entry point in
+///   turn
+/// \return the exit code of the first entry point that could not be
+///   verified successfully, or CPROVER_EXIT_SUCCESS
+int jbmc_parse_optionst::verify_entry_points(optionst &options)
+{
+  java_class_loadert::parse_tree_cachet parse_tree_cache;
+  int exit_code = CPROVER_EXIT_SUCCESS;
+
+  for(const std::string &function : cmdline.get_values("function"))
+  {
+    log.status() << "Verifying entry point " << function << messaget::eom;
+
+    options.set_option("function", function);
+    config.main = function;
+
+    std::unique_ptr<abstract_goto_modelt> goto_model_ptr;
+    int entry_point_exit_code =
+      get_goto_program(goto_model_ptr, options, &parse_tree_cache);
+    if(entry_point_exit_code == -1)
+      entry_point_exit_code = verify(options, *goto_model_ptr);
+
+    if(ui_message_handler.get_ui() == ui_message_handlert::uit::JSON_UI)
+    {
+      json_objectt json_result{
+        {"entryPoint", json_stringt(function)},
+        {"exitCode", json_numbert(std::to_string(entry_point_exit_code))}};
+      log.result() << json_result;
+    }
+    else
+    {
+      log.result() << "Entry point " << function << ": exit code "
+                   << entry_point_exit_code << messaget::eom;
+    }
+
+    if(exit_code == CPROVER_EXIT_SUCCESS)
+      exit_code = entry_point_exit_code;
+  }
+
+  return exit_code;
+}
+
+/// Run the verifier selected by \p options on \p goto_model and, when
+/// functions are loaded on demand, report those that symex never loaded
+/// \return the exit code
+int jbmc_parse_optionst::verify(
+  const optionst &options,
+  abstract_goto_modelt &goto_model)
+{
+  const int exit_code = run_verifier(options, goto_model);
+
+  if(options.get_bool_option("symex-driven-lazy-loading"))
+    report_unloaded_functions(goto_model);
+
+  return exit_code;
+}
+
+/// Run the verifier selected by \p options on \p goto_model
+/// \return the exit code
+int jbmc_parse_optionst::run_verifier(
+  const optionst &options,
+  abstract_goto_modelt &goto_model)
+{
   if(
     options.get_bool_option("program-only") ||
     options.get_bool_option("show-vcc") ||
@@ -565,21 +638,21 @@ int jbmc_parse_optionst::doit()
     if(options.get_bool_option("paths"))
     {
       all_properties_verifiert<java_single_path_symex_only_checkert> verifier(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
       (void)verifier();
     }
     else
     {
       all_properties_verifiert<java_multi_path_symex_only_checkert> verifier(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
       (void)verifier();
     }
 
     if(options.get_bool_option("symex-driven-lazy-loading"))
     {
       // We can only output these after goto-symex has run.
-      (void)show_loaded_symbols(*goto_model_ptr);
-      (void)show_loaded_functions(*goto_model_ptr);
+      (void)show_loaded_symbols(goto_model);
+      (void)show_loaded_functions(goto_model);
     }
 
     return CPROVER_EXIT_SUCCESS;
@@ -591,13 +664,13 @@ int jbmc_parse_optionst::doit()
     if(options.get_bool_option("paths"))
     {
       stop_on_fail_verifiert<java_single_path_symex_checkert> verifier(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
       (void)verifier();
     }
     else
     {
       stop_on_fail_verifiert<java_multi_path_symex_checkert> verifier(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
       (void)verifier();
     }
 
@@ -611,7 +684,7 @@ int jbmc_parse_optionst::doit()
   {
     verifier =
       util_make_unique<stop_on_fail_verifiert<java_single_path_symex_checkert>>(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
   }
   else if(
     options.get_bool_option("stop-on-fail") &&
@@ -622,13 +695,13 @@ int jbmc_parse_optionst::doit()
       verifier =
         util_make_unique<stop_on_fail_verifier_with_fault_localizationt<
           java_multi_path_symex_checkert>>(
-          options, ui_message_handler, *goto_model_ptr);
+          options, ui_message_handler, goto_model);
     }
     else
     {
       verifier = util_make_unique<
         stop_on_fail_verifiert<java_multi_path_symex_checkert>>(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
     }
   }
   else if(
@@ -637,7 +710,7 @@ int jbmc_parse_optionst::doit()
   {
     verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
       java_single_path_symex_checkert>>(
-      options, ui_message_handler, *goto_model_ptr);
+      options, ui_message_handler, goto_model);
   }
   else if(
     !options.get_bool_option("stop-on-fail") &&
@@ -648,13 +721,13 @@ int jbmc_parse_optionst::doit()
       verifier =
         util_make_unique<all_properties_verifier_with_fault_localizationt<
           java_multi_path_symex_checkert>>(
-          options, ui_message_handler, *goto_model_ptr);
+          options, ui_message_handler, goto_model);
     }
     else
     {
       verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
         java_multi_path_symex_checkert>>(
-        options, ui_message_handler, *goto_model_ptr);
+        options, ui_message_handler, goto_model);
     }
   }
   else
@@ -664,16 +737,46 @@ int jbmc_parse_optionst::doit()
 
   const resultt result = (*verifier)();
   verifier->report();
+
   return result_to_exit_code(result);
 }
 
 int jbmc_parse_optionst::get_goto_program(
   std::unique_ptr<abstract_goto_modelt> &goto_model_ptr,
-  const optionst &options)
+  const optionst &options,
+  java_class_loadert::parse_tree_cachet *parse_tree_cache)
 {
+  // Library methods converted by earlier runs are restored from the cache,
+  // and the user classes are converted on top of them
+  optionalt<java_library_cachet> library_cache;
+  if(cmdline.isset("java-model-cache"))
+  {
+    const auto key =
+      java_library_cache_key(config.java.classpath, ui_message_handler);
+    if(key.has_value())
+    {
+      library_cache.emplace(cmdline.get_value("java-model-cache"), *key);
+      library_cache->read(ui_message_handler);
+    }
+  }
+
   lazy_goto_modelt lazy_goto_model =
     lazy_goto_modelt::from_handler_object(*this, options, ui_message_handler);
-  lazy_goto_model.initialize(cmdline.args, options);
+  lazy_goto_model.initialize(
+    cmdline.args,
+    options,
+    [parse_tree_cache, &library_cache](languaget &language) {
+      auto java_language = dynamic_cast<java_bytecode_languaget *>(&language);
+      if(java_language != nullptr)
+      {
+        java_language->set_parse_tree_cache(parse_tree_cache);
+        if(library_cache.has_value())
+          java_language->set_library_cache(&*library_cache);
+      }
+    });
+
+  if(library_cache.has_value())
+    library_cache->write(ui_message_handler);
 
   class_hierarchy =
     util_make_unique<class_hierarchyt>(lazy_goto_model.symbol_table);
@@ -880,6 +983,54 @@ bool jbmc_parse_optionst::show_loaded_functions(
   return false;
 }
 
+/// With symex-driven lazy loading, report the Java methods that symex never
+/// reached, and therefore were never converted, and the classes none of whose
+/// methods were converted. The counts are statistics, the lists debug output.
+void jbmc_parse_optionst::report_unloaded_functions(
+  const abstract_goto_modelt &goto_model)
+{
+  const auto &function_map = goto_model.get_goto_functions().function_map;
+
+  std::size_t method_count = 0;
+  std::vector<irep_idt> unloaded_methods;
+  std::set<irep_idt> classes;
+  std::set<irep_idt> classes_with_loaded_methods;
+
+  for(const auto &id_and_symbol : goto_model.get_symbol_table())
+  {
+    const symbolt &symbol = id_and_symbol.second;
+    if(symbol.mode != ID_java || symbol.type.id() != ID_code)
+      continue;
+
+    const auto class_id = declaring_class(symbol);
+    if(!class_id.has_value())
+      continue;
+
+    ++method_count;
+    classes.insert(*class_id);
+
+    if(function_map.count(symbol.name) != 0)
+      classes_with_loaded_methods.insert(*class_id);
+    else
+      unloaded_methods.push_back(symbol.name);
+  }
+
+  log.statistics() << "Lazy loading: " << unloaded_methods.size() << " of "
+                   << method_count << " methods and "
+                   << classes.size() - classes_with_loaded_methods.size()
+                   << " of " << classes.size()
+                   << " classes were never materialised" << messaget::eom;
+
+  for(const auto &method : unloaded_methods)
+    log.debug() << "Method never materialised: " << method << messaget::eom;
+
+  for(const auto &class_id : classes)
+  {
+    if(classes_with_loaded_methods.count(class_id) == 0)
+      log.debug() << "Class never materialised: " << class_id << messaget::eom;
+  }
+}
+
 bool jbmc_parse_optionst::process_goto_functions(
   goto_modelt &goto_model,
   const optionst &options)
@@ -1043,8 +1194,11 @@ void jbmc_parse_optionst::help()
     " --stop-on-fail               stop analysis once a failed property is detected\n" // NOLINT(*)
     " --trace                      give a counterexample trace for failed properties\n" //NOLINT(*)
     HELP_JAVA_TRACE_VALIDATION
+    HELP_JAVA_MODEL_CACHE
     "\n"
     HELP_FUNCTIONS
+    "                              if given several times, verify each entry point\n" // NOLINT(*)
+    "                              in turn, parsing the class files only once\n" // NOLINT(*)
     "\n"
     "Program representations:\n"
     " --show-parse-tree            show parse tree\n"
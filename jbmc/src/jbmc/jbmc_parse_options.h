@@ -33,6 +33,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <solvers/strings/string_refinement.h>
 
 #include <java_bytecode/java_bytecode_language.h>
+#include <java_bytecode/java_model_cache.h>
 
 #include <json/json_interface.h>
 #include <xmllang/xml_interface.h>
@@ -72,6 +73,7 @@ class optionst;
   "(verbosity):" \
   "(nondet-static)" \
   OPT_JAVA_TRACE_VALIDATION \
+  OPT_JAVA_MODEL_CACHE \
   "(version)" \
   "(symex-coverage-report):" \
   OPT_TIMESTAMP \
@@ -130,9 +132,14 @@ protected:
   void get_command_line_options(optionst &);
   int get_goto_program(
     std::unique_ptr<abstract_goto_modelt> &goto_model,
-    const optionst &);
+    const optionst &,
+    java_class_loadert::parse_tree_cachet *parse_tree_cache = nullptr);
   bool show_loaded_functions(const abstract_goto_modelt &goto_model);
   bool show_loaded_symbols(const abstract_goto_modelt &goto_model);
+  void report_unloaded_functions(const abstract_goto_modelt &goto_model);
+  int verify_entry_points(optionst &);
+  int verify(const optionst &, abstract_goto_modelt &goto_model);
+  int run_verifier(const optionst &, abstract_goto_modelt &goto_model);
 };
 
 #endif // CPROVER_JBMC_JBMC_PARSE_OPTIONS_H
@@ -20,6 +20,9 @@ exprt resolve_classid_test(
   const irep_idt &actual_class_id,
   const namespacet &ns)
 {
+  if(expr.is_constant())
+    return expr;
+
   if(expr.id() == ID_or || expr.id() == ID_and)
   {
     exprt resolved = expr;
@@ -315,4 +318,46 @@ SCENARIO(
             test_program, "java::NoSuchClass", ns)));
     }
   }
+
+  WHEN("Resolving virtual callsite with more callees than are tested in turn")
+  {
+    const std::vector<irep_idt> callees = {
+      "java::VirtualFunctionsTestParent.f:()V",
+      "java::VirtualFunctionsTestChild1.f:()V",
+      "java::VirtualFunctionsTestChild2.f:()V"};
+
+    // neighbouring entries have different targets, so that each class needs
+    // a test of its own
+    dispatch_table_entriest dispatch_table;
+    for(std::size_t i = 0; i < 20; ++i)
+    {
+      dispatch_table.emplace_back("java::C" + std::to_string(i));
+      dispatch_table.back().symbol_expr =
+        symbol_table.lookup_ref(callees[i % callees.size()]).symbol_expr();
+    }
+
+    remove_virtual_function(
+      symbol_table,
+      test_program_id,
+      test_program,
+      virtual_call_inst,
+      dispatch_table,
+      virtual_dispatch_fallback_actiont::ASSUME_FALSE);
+
+    THEN("Each class should call its respective target, "
+         "others should assume false")
+    {
+      for(std::size_t i = 0; i < 20; ++i)
+      {
+        REQUIRE(is_call_to(
+          interpret_classid_comparison(
+            test_program, "java::C" + std::to_string(i), ns),
+          callees[i % callees.size()]));
+      }
+      REQUIRE(
+        is_assume_false(
+          interpret_classid_comparison(
+            test_program, "java::NoSuchClass", ns)));
+    }
+  }
 }
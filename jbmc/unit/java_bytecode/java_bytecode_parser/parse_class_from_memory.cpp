@@ -0,0 +1,52 @@
+/*******************************************************************\
+
+Module: Unit tests to parse a class held in memory
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <java_bytecode/java_bytecode_parse_tree.h>
+#include <java_bytecode/java_bytecode_parser.h>
+#include <testing-utils/message.h>
+
+#include <testing-utils/use_catch.h>
+
+#include <fstream>
+#include <iterator>
+
+SCENARIO(
+  "java_bytecode_parse_class_from_memory",
+  "[core][java_bytecode][java_bytecode_parser]")
+{
+  std::ifstream in(
+    "./java_bytecode/java_bytecode_parser/Trivial$Inner.class",
+    std::ios::binary);
+  REQUIRE(in);
+  const std::string class_file(
+    (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+  WHEN("Parsing the whole class file")
+  {
+    const auto loaded = java_bytecode_parse(
+      class_file.data(), class_file.size(), null_message_handler);
+
+    THEN("Loading should succeed")
+    {
+      REQUIRE(loaded);
+      REQUIRE(loaded->parsed_class.name == "Trivial$Inner");
+      REQUIRE(loaded->parsed_class.methods.size() == 2);
+    }
+  }
+
+  WHEN("Parsing a truncated class file")
+  {
+    const auto loaded = java_bytecode_parse(
+      class_file.data(), class_file.size() / 2, null_message_handler);
+
+    THEN("Loading should fail")
+    {
+      REQUIRE_FALSE(loaded);
+    }
+  }
+}
@@ -0,0 +1,152 @@
+/*******************************************************************\
+
+Module: Unit tests for the cache of converted Java library methods
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <java_bytecode/java_model_cache.h>
+
+#include <util/std_code.h>
+#include <util/std_types.h>
+#include <util/tempdir.h>
+
+#include <fstream>
+
+static void write_file(const std::string &path, const std::string &contents)
+{
+  std::ofstream out(path, std::ios::binary);
+  out << contents;
+}
+
+SCENARIO(
+  "Keys of the Java library cache",
+  "[core][java_bytecode][java_model_cache]")
+{
+  temp_dirt temp_dir("java_model_cacheXXXXXX");
+  const std::string library = temp_dir("library.jar");
+  write_file(library, "first version");
+  const std::string models = temp_dir("models.jar");
+  write_file(models, "models");
+
+  const auto key =
+    java_library_cache_key({library, models}, null_message_handler);
+  REQUIRE(key.has_value());
+
+  THEN("The key depends on the contents of the JAR files")
+  {
+    write_file(library, "second version");
+    REQUIRE(
+      java_library_cache_key({library, models}, null_message_handler) != key);
+  }
+
+  THEN("The key depends on the order of the JAR files")
+  {
+    REQUIRE(
+      java_library_cache_key({models, library}, null_message_handler) != key);
+  }
+
+  THEN("The key does not depend on directories holding user classes")
+  {
+    REQUIRE(
+      java_library_cache_key(
+        {library, temp_dir.path, models}, null_message_handler) == key);
+  }
+
+  THEN("There is no key if a JAR file cannot be read")
+  {
+    REQUIRE_FALSE(java_library_cache_key(
+                    {library, temp_dir("missing.jar")}, null_message_handler)
+                    .has_value());
+  }
+}
+
+SCENARIO(
+  "Library methods stored in the Java library cache",
+  "[core][java_bytecode][java_model_cache]")
+{
+  temp_dirt temp_dir("java_model_cacheXXXXXX");
+  const std::string cache_dir = temp_dir("cache");
+  const irep_idt method_id = "java::A.f:()V";
+  const irep_idt local_id = "java::A.f:()V::x";
+  const irep_idt global_id = "java::A.y";
+
+  // A symbol table as the front-end creates it before converting A.f
+  symbol_tablet symbol_table;
+  symbolt method;
+  method.name = method_id;
+  method.mode = ID_java;
+  method.type = code_typet({}, empty_typet());
+  symbol_table.add(method);
+  symbolt global;
+  global.name = global_id;
+  global.mode = ID_java;
+  global.type = signedbv_typet(32);
+  global.is_static_lifetime = true;
+  symbol_table.add(global);
+
+  GIVEN("The conversion of A.f stored in the cache")
+  {
+    symbol_tablet converted = symbol_table;
+    symbolt local;
+    local.name = local_id;
+    local.mode = ID_java;
+    local.type = signedbv_typet(32);
+    converted.add(local);
+    converted.get_writeable_ref(method_id).value =
+      code_assignt(local.symbol_expr(), global.symbol_expr());
+
+    java_library_cachet::neededt needed;
+    needed.methods.insert(method_id);
+
+    {
+      java_library_cachet cache(cache_dir, "0123456789abcdef");
+      cache.read(null_message_handler);
+      cache.store_method(method_id, "settings", converted, {local_id}, needed);
+      cache.write(null_message_handler);
+    }
+
+    java_library_cachet cache(cache_dir, "0123456789abcdef");
+    cache.read(null_message_handler);
+
+    THEN("A later run restores the body and the symbols it introduced")
+    {
+      const auto restored =
+        cache.restore_method(method_id, "settings", symbol_table);
+      REQUIRE(restored.has_value());
+      REQUIRE(restored->methods == needed.methods);
+      REQUIRE(restored->classes.empty());
+      REQUIRE(symbol_table.lookup_ref(method_id).value.is_not_nil());
+      REQUIRE(symbol_table.has_symbol(local_id));
+    }
+
+    THEN("A run with different conversion settings converts it again")
+    {
+      REQUIRE_FALSE(
+        cache.restore_method(method_id, "other settings", symbol_table)
+          .has_value());
+      REQUIRE(symbol_table.lookup_ref(method_id).value.is_nil());
+    }
+
+    THEN("A run lacking a symbol the body refers to converts it again")
+    {
+      symbol_table.remove(global_id);
+      REQUIRE_FALSE(
+        cache.restore_method(method_id, "settings", symbol_table).has_value());
+      REQUIRE(symbol_table.lookup_ref(method_id).value.is_nil());
+      REQUIRE_FALSE(symbol_table.has_symbol(local_id));
+    }
+
+    THEN("Other keys do not share the methods")
+    {
+      java_library_cachet other(cache_dir, "fedcba9876543210");
+      other.read(null_message_handler);
+      REQUIRE_FALSE(
+        other.restore_method(method_id, "settings", symbol_table).has_value());
+    }
+  }
+}
@@ -0,0 +1,25 @@
+#include <assert.h>
+
+int x = 0;
+
+void child(void)
+{
+  // the writes of 0 and 1 are hidden by that of 2, which precedes the spawn
+  assert(x == 2 || x == 3);
+}
+
+void parent(void)
+{
+  x = 1;
+  x = 2;
+__CPROVER_ASYNC_1:
+  child();
+  x = 3;
+}
+
+int main(void)
+{
+__CPROVER_ASYNC_1:
+  parent();
+  return 0;
+}
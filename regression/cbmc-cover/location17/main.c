@@ -0,0 +1,18 @@
+int unused(int x)
+{
+  return x + 1;
+}
+
+int main()
+{
+  int input;
+  int x = 0;
+
+  if(input)
+    x = 1;
+
+  if(0)
+    x = 2; // not reachable
+
+  return x;
+}
@@ -0,0 +1,15 @@
+#include <cassert>
+
+template <class T>
+T twice(T x)
+{
+  return x + x;
+}
+
+int main()
+{
+  int a = twice<int>(1);
+  int b = twice<int>(2);
+  assert(a + b == 6);
+  return 0;
+}
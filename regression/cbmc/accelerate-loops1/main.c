@@ -0,0 +1,20 @@
+#include <assert.h>
+
+int main()
+{
+  unsigned n;
+  __CPROVER_assume(n <= 100000);
+
+  unsigned i, sum = 0, last = 0;
+  for(i = 0; i < n; i++)
+  {
+    sum += 3;
+    last = 1;
+  }
+
+  assert(i == n);
+  assert(sum == 3 * n);
+  assert(last == (n != 0));
+
+  return 0;
+}
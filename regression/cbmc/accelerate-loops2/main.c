@@ -0,0 +1,15 @@
+#include <assert.h>
+
+int main()
+{
+  int n;
+  __CPROVER_assume(n <= 10);
+
+  int i, product = 1;
+  for(i = 0; i < n; i++)
+    product *= 2;
+
+  assert(product != 1024);
+
+  return 0;
+}
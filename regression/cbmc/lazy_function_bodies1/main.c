@@ -0,0 +1,26 @@
+#include <assert.h>
+
+struct S
+{
+  int x;
+};
+
+int unreachable(struct S *s)
+{
+  // not a member of struct S: only reported when this body is type checked
+  return s->y;
+}
+
+int reachable(struct S *s)
+{
+  static int calls;
+  ++calls;
+  return s->x + calls;
+}
+
+int main()
+{
+  struct S s = {41};
+  assert(reachable(&s) == 42);
+  return 0;
+}
@@ -0,0 +1,17 @@
+#include <assert.h>
+
+struct s
+{
+  int a;
+  int b;
+};
+
+int get_b(void);
+
+int main()
+{
+  struct s x = {1, 2};
+  assert(x.b == 2);
+  assert(get_b() == 20);
+  return 0;
+}
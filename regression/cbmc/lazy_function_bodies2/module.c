@@ -0,0 +1,11 @@
+// clashes with struct s in main.c, hence renamed during linking
+struct s
+{
+  int b;
+};
+
+int get_b(void)
+{
+  struct s y = {20};
+  return y.b;
+}
@@ -0,0 +1,19 @@
+int global;
+
+void g(void)
+{
+  global = 1;
+}
+
+int main()
+{
+  g();
+
+  int i;
+  for(i = 0; i < 3; ++i)
+  {
+  }
+
+  __CPROVER_assert(global == 1, "loop does not modify global");
+  return 0;
+}
@@ -0,0 +1,32 @@
+#include <assert.h>
+
+int small(int i)
+{
+  return i + 1;
+}
+
+int big(int i)
+{
+  int j = i;
+  j = j * 2;
+  j = j + 3;
+  j = j * 5;
+  j = j - 7;
+  j = j / 2;
+  j = j + 11;
+  j = j - 13;
+  j = j * 17;
+  j = j + 19;
+  return j;
+}
+
+int main()
+{
+  int x = 0;
+
+  for(int i = 0; i < 3; ++i)
+    x = small(x);
+
+  x = big(x);
+  assert(x == 308);
+}
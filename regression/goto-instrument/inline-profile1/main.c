@@ -0,0 +1,40 @@
+#include <assert.h>
+
+int looped(int i)
+{
+  int j = i;
+  j = j + 2;
+  j = j - 1;
+  j = j * 3;
+  j = j / 3;
+  j = j + 4;
+  j = j - 4;
+  j = j * 5;
+  j = j / 5;
+  return j;
+}
+
+int once(int i)
+{
+  int j = i;
+  j = j + 3;
+  j = j - 1;
+  j = j * 3;
+  j = j / 3;
+  j = j + 4;
+  j = j - 4;
+  j = j * 5;
+  j = j / 5;
+  return j;
+}
+
+int main()
+{
+  int x = 0;
+
+  for(int i = 0; i < 3; ++i)
+    x = looped(x);
+
+  x = once(x);
+  assert(x == 5);
+}
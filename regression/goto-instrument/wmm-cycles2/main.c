@@ -0,0 +1,28 @@
+int x = 0;
+int y = 0;
+
+void *P0(void *arg)
+{
+  for(int i = 0; i < 2; ++i)
+  {
+    int r1 = y;
+    x = 1;
+  }
+  return 0;
+}
+
+void *P1(void *arg)
+{
+  y = 1;
+  int r2 = x;
+  return 0;
+}
+
+int main()
+{
+__CPROVER_ASYNC_0:
+  P0(0);
+__CPROVER_ASYNC_1:
+  P1(0);
+  return 0;
+}
@@ -129,7 +129,7 @@ void dep_graph_domaint::control_dependencies(
   }
 }
 
-static bool may_be_def_use_pair(
+bool may_be_def_use_pair(
   const mp_integer &w_start,
   const mp_integer &w_end,
   const mp_integer &r_start,
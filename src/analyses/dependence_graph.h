@@ -63,6 +63,15 @@ struct dep_nodet:public graph_nodet<dep_edget>
   goto_programt::const_targett PC;
 };
 
+/// \return true if a write to the range [\p w_start, \p w_end) of an object
+///   may define a read of its range [\p r_start, \p r_end), where an end of
+///   -1 denotes an unknown end
+bool may_be_def_use_pair(
+  const mp_integer &w_start,
+  const mp_integer &w_end,
+  const mp_integer &r_start,
+  const mp_integer &r_end);
+
 class dep_graph_domaint:public ai_domain_baset
 {
 public:
@@ -15,6 +15,7 @@ Date: February 2013
 
 #include "reaching_definitions.h"
 
+#include <algorithm>
 #include <memory>
 
 #include <util/pointer_offset_size.h>
@@ -35,6 +36,154 @@ reaching_definitions_analysist::reaching_definitions_analysist(
 
 reaching_definitions_analysist::~reaching_definitions_analysist()=default;
 
+const std::size_t rd_id_sett::word_bits;
+const std::size_t rd_id_sett::chunk_words;
+const std::size_t rd_id_sett::chunk_bits;
+
+/// \return the first chunk in [\p begin, \p end) whose index is not less
+///   than \p index
+template <typename iteratort>
+static iteratort
+find_chunk(iteratort begin, iteratort end, const std::size_t index)
+{
+  return std::lower_bound(
+    begin, end, index, [](const rd_id_sett::chunkt &chunk, std::size_t i) {
+      return chunk.index < i;
+    });
+}
+
+void rd_id_sett::const_iterator::skip_unset()
+{
+  for(; chunk != end; ++chunk, bit = 0)
+  {
+    while(bit < chunk_bits)
+    {
+      wordt word = chunk->words[bit / word_bits] >> (bit % word_bits);
+
+      if(word == 0)
+      {
+        bit = (bit / word_bits + 1) * word_bits;
+        continue;
+      }
+
+      for(; (word & 1) == 0; word >>= 1)
+        ++bit;
+
+      return;
+    }
+  }
+}
+
+bool rd_id_sett::contains(const std::size_t id) const
+{
+  const std::size_t index = id / chunk_bits;
+  const auto chunk = find_chunk(chunks.begin(), chunks.end(), index);
+
+  if(chunk == chunks.end() || chunk->index != index)
+    return false;
+
+  const std::size_t bit = id % chunk_bits;
+  return (chunk->words[bit / word_bits] >> (bit % word_bits)) & 1;
+}
+
+bool rd_id_sett::insert(const std::size_t id)
+{
+  const std::size_t index = id / chunk_bits;
+  const std::size_t bit = id % chunk_bits;
+  const wordt mask = wordt(1) << (bit % word_bits);
+
+  const auto chunk = find_chunk(chunks.begin(), chunks.end(), index);
+
+  if(chunk == chunks.end() || chunk->index != index)
+  {
+    chunkt new_chunk;
+    new_chunk.index = index;
+    new_chunk.words.fill(0);
+    new_chunk.words[bit / word_bits] = mask;
+    chunks.insert(chunk, new_chunk);
+    return true;
+  }
+
+  wordt &word = chunk->words[bit / word_bits];
+  if(word & mask)
+    return false;
+
+  word |= mask;
+  return true;
+}
+
+void rd_id_sett::erase(const std::size_t id)
+{
+  const std::size_t index = id / chunk_bits;
+  const auto chunk = find_chunk(chunks.begin(), chunks.end(), index);
+
+  if(chunk == chunks.end() || chunk->index != index)
+    return;
+
+  const std::size_t bit = id % chunk_bits;
+  chunk->words[bit / word_bits] &= ~(wordt(1) << (bit % word_bits));
+
+  wordt any = 0;
+  for(std::size_t i = 0; i < chunk_words; ++i)
+    any |= chunk->words[i];
+
+  if(any == 0)
+    chunks.erase(chunk);
+}
+
+bool rd_id_sett::includes(const rd_id_sett &other) const
+{
+  chunkst::const_iterator chunk = chunks.begin();
+
+  for(const auto &other_chunk : other.chunks)
+  {
+    chunk = find_chunk(chunk, chunks.end(), other_chunk.index);
+    if(chunk == chunks.end() || chunk->index != other_chunk.index)
+      return false;
+
+    wordt missing = 0;
+    for(std::size_t i = 0; i < chunk_words; ++i)
+      missing |= other_chunk.words[i] & ~chunk->words[i];
+
+    if(missing != 0)
+      return false;
+  }
+
+  return true;
+}
+
+void rd_id_sett::merge(const rd_id_sett &other)
+{
+  chunkst result;
+  result.reserve(chunks.size() + other.chunks.size());
+
+  chunkst::const_iterator chunk = chunks.begin();
+  chunkst::const_iterator other_chunk = other.chunks.begin();
+
+  while(chunk != chunks.end() && other_chunk != other.chunks.end())
+  {
+    if(chunk->index < other_chunk->index)
+      result.push_back(*chunk++);
+    else if(other_chunk->index < chunk->index)
+      result.push_back(*other_chunk++);
+    else
+    {
+      result.push_back(*chunk++);
+      chunkt &merged = result.back();
+
+      for(std::size_t i = 0; i < chunk_words; ++i)
+        merged.words[i] |= other_chunk->words[i];
+
+      ++other_chunk;
+    }
+  }
+
+  result.insert(result.end(), chunk, chunks.cend());
+  result.insert(result.end(), other_chunk, other.chunks.cend());
+
+  chunks.swap(result);
+}
+
 /// Given the passed variable name `identifier` it collects data from
 /// `bv_container` for each `ID` in `values[identifier]` and stores them into
 /// `export_cache[identifier]`. Namely, for each `reaching_definitiont` instance
@@ -49,12 +198,12 @@ void rd_range_domaint::populate_cache(const irep_idt &identifier) const
 
   valuest::const_iterator v_entry=values.find(identifier);
   if(v_entry==values.end() ||
-     v_entry->second.empty())
+     v_entry->second.read().empty())
     return;
 
   ranges_at_loct &export_entry=export_cache[identifier];
 
-  for(const auto &id : v_entry->second)
+  for(const auto &id : v_entry->second.read())
   {
     const reaching_definitiont &v=bv_container->get(id);
 
@@ -261,14 +410,14 @@ void rd_range_domaint::transform_end_function(
        (!ns.lookup(identifier).is_shared() &&
         !rd.get_is_dirty()(identifier)))
     {
-      for(const auto &id : new_value.second)
+      for(const auto &id : new_value.second.read())
       {
         const reaching_definitiont &v=bv_container->get(id);
         kill(v.identifier, v.bit_begin, v.bit_end);
       }
     }
 
-    for(const auto &id : new_value.second)
+    for(const auto &id : new_value.second.read())
     {
       const reaching_definitiont &v=bv_container->get(id);
       gen(v.definition_at, v.identifier, v.bit_begin, v.bit_end);
@@ -362,85 +511,70 @@ void rd_range_domaint::kill(
   if(entry==values.end())
     return;
 
-  bool clear_export_cache=false;
-  values_innert new_values;
+  // the set is only written to, and thus copied if shared, if anything is
+  // killed
+  std::vector<std::size_t> killed;
+  std::vector<std::size_t> new_values;
 
-  for(values_innert::iterator
-      it=entry->second.begin();
-      it!=entry->second.end();
-     ) // no ++it
+  for(const auto &id : entry->second.read())
   {
-    const reaching_definitiont &v=bv_container->get(*it);
+    const reaching_definitiont &v=bv_container->get(id);
 
     if(v.bit_begin >= range_end)
-      ++it;
+      continue;
     else if(v.bit_end!=-1 &&
             v.bit_end <= range_start)
-      ++it;
+      continue;
     else if(v.bit_begin >= range_start &&
             v.bit_end!=-1 &&
             v.bit_end <= range_end) // rs <= a < b <= re
     {
-      clear_export_cache=true;
-
-      entry->second.erase(it++);
+      killed.push_back(id);
     }
     else if(v.bit_begin >= range_start) // rs <= a <= re < b
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_begin=range_end;
-      new_values.insert(bv_container->add(v_new));
+      new_values.push_back(bv_container->add(v_new));
 
-      entry->second.erase(it++);
+      killed.push_back(id);
     }
     else if(v.bit_end==-1 ||
             v.bit_end > range_end) // a <= rs < re < b
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_end=range_start;
 
       reaching_definitiont v_new2=v;
       v_new2.bit_begin=range_end;
 
-      new_values.insert(bv_container->add(v_new));
-      new_values.insert(bv_container->add(v_new2));
+      new_values.push_back(bv_container->add(v_new));
+      new_values.push_back(bv_container->add(v_new2));
 
-      entry->second.erase(it++);
+      killed.push_back(id);
     }
     else // a <= rs < b <= re
     {
-      clear_export_cache=true;
-
       reaching_definitiont v_new=v;
       v_new.bit_end=range_start;
-      new_values.insert(bv_container->add(v_new));
+      new_values.push_back(bv_container->add(v_new));
 
-      entry->second.erase(it++);
+      killed.push_back(id);
     }
   }
 
-  if(clear_export_cache)
-    export_cache.erase(identifier);
+  if(killed.empty())
+    return;
+
+  export_cache.erase(identifier);
+
+  rd_id_sett &ids=entry->second.write(true);
+
+  for(const auto &id : killed)
+    ids.erase(id);
 
-  values_innert::iterator it=entry->second.begin();
   for(const auto &id : new_values)
-  {
-    while(it!=entry->second.end() && *it<id)
-      ++it;
-    if(it==entry->second.end() || id<*it)
-    {
-      entry->second.insert(it, id);
-    }
-    else if(it!=entry->second.end())
-    {
-      assert(*it==id);
-      ++it;
-    }
-  }
+    ids.insert(id);
 }
 
 void rd_range_domaint::kill_inf(
@@ -502,9 +636,14 @@ bool rd_range_domaint::gen(
   v.bit_begin=range_start;
   v.bit_end=range_end;
 
-  if(!values[identifier].insert(bv_container->add(v)).second)
+  values_innert &ids=values[identifier];
+  const std::size_t id=bv_container->add(v);
+
+  if(ids.read().contains(id))
     return false;
 
+  ids.write(true).insert(id);
+
   export_cache.erase(identifier);
 
 #if 0
@@ -597,50 +736,16 @@ bool rd_range_domaint::merge_inner(
   values_innert &dest,
   const values_innert &other)
 {
-  bool more=false;
-
-#if 0
-  ranges_at_loct::iterator itr=it->second.begin();
-  for(const auto &o : ito->second)
-  {
-    while(itr!=it->second.end() && itr->first<o.first)
-      ++itr;
-    if(itr==it->second.end() || o.first<itr->first)
-    {
-      it->second.insert(o);
-      more=true;
-    }
-    else if(itr!=it->second.end())
-    {
-      assert(itr->first==o.first);
-
-      for(const auto &o_range : o.second)
-        more=gen(itr->second, o_range.first, o_range.second) ||
-          more;
+  // unchanged sets remain shared
+  if(dest==other || dest.read().includes(other.read()))
+    return false;
 
-      ++itr;
-    }
-  }
-#else
-  values_innert::iterator itr=dest.begin();
-  for(const auto &id : other)
-  {
-    while(itr!=dest.end() && *itr<id)
-      ++itr;
-    if(itr==dest.end() || id<*itr)
-    {
-      dest.insert(itr, id);
-      more=true;
-    }
-    else if(itr!=dest.end())
-    {
-      assert(*itr==id);
-      ++itr;
-    }
-  }
-#endif
+  if(dest.read().empty())
+    dest=other;
+  else
+    dest.write(true).merge(other.read());
 
-  return more;
+  return true;
 }
 
 /// \return returns true iff there is something new
@@ -25,7 +25,12 @@ Date: February 2013
 #ifndef CPROVER_ANALYSES_REACHING_DEFINITIONS_H
 #define CPROVER_ANALYSES_REACHING_DEFINITIONS_H
 
+#include <array>
+#include <cstdint>
+#include <iterator>
+
 #include <util/base_exceptions.h>
+#include <util/cow.h>
 #include <util/threeval.h>
 
 #include "ai.h"
@@ -127,6 +132,113 @@ inline bool operator<(
   return false;
 }
 
+/// A set of `ID`s as provided by `sparse_bitvector_analysist`. The set is
+/// stored as a bitset that is split into chunks of `chunk_bits` consecutive
+/// `ID`s, only the non-empty ones of which are kept, ordered by their
+/// position. The definitions of a single variable tend to have nearby `ID`s,
+/// which keeps the chunks dense, while the `ID`s of all definitions would make
+/// a single bitset per variable and instruction too large.
+/// Union and inclusion are computed a chunk at a time on whole words, which
+/// compilers can vectorise.
+class rd_id_sett : public copy_on_write_pointeet<unsigned>
+{
+public:
+  typedef std::uint64_t wordt;
+
+  static const std::size_t word_bits = 64;
+  static const std::size_t chunk_words = 4;
+  static const std::size_t chunk_bits = word_bits * chunk_words;
+
+  struct chunkt
+  {
+    std::size_t index;
+    std::array<wordt, chunk_words> words;
+  };
+
+  typedef std::vector<chunkt> chunkst;
+
+  /// Iterates over the `ID`s in ascending order
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef std::size_t value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const std::size_t *pointer;
+    typedef std::size_t reference;
+
+    const_iterator(
+      chunkst::const_iterator _chunk,
+      chunkst::const_iterator _end,
+      std::size_t _bit)
+      : chunk(_chunk), end(_end), bit(_bit)
+    {
+      skip_unset();
+    }
+
+    std::size_t operator*() const
+    {
+      return chunk->index * chunk_bits + bit;
+    }
+
+    const_iterator &operator++()
+    {
+      ++bit;
+      skip_unset();
+      return *this;
+    }
+
+    bool operator==(const const_iterator &other) const
+    {
+      return chunk == other.chunk && bit == other.bit;
+    }
+
+    bool operator!=(const const_iterator &other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    chunkst::const_iterator chunk;
+    chunkst::const_iterator end;
+    std::size_t bit;
+
+    void skip_unset();
+  };
+
+  const_iterator begin() const
+  {
+    return const_iterator(chunks.begin(), chunks.end(), 0);
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(chunks.end(), chunks.end(), 0);
+  }
+
+  bool empty() const
+  {
+    return chunks.empty();
+  }
+
+  bool contains(std::size_t id) const;
+
+  /// \return true iff \p id was not in the set
+  bool insert(std::size_t id);
+
+  void erase(std::size_t id);
+
+  /// \return true iff all `ID`s in \p other are in this set
+  bool includes(const rd_id_sett &other) const;
+
+  /// Add all `ID`s in \p other to this set
+  void merge(const rd_id_sett &other);
+
+private:
+  /// Non-empty chunks ordered by `index`
+  chunkst chunks;
+};
+
 /// Because the class is inherited from `ai_domain_baset`, its instance
 /// represents an element of a domain of the reaching definitions abstract
 /// interpretation analysis. Each instance is thus associated with exactly one
@@ -260,7 +372,9 @@ private:
   /// `this` is passed to `set_bitvector_container` for all instances.
   sparse_bitvector_analysist<reaching_definitiont> *bv_container;
 
-  typedef std::set<std::size_t> values_innert;
+  /// The sets are shared between the domain elements they have been copied
+  /// to, until they are changed.
+  typedef copy_on_writet<rd_id_sett> values_innert;
   #ifdef USE_DSTRING
   typedef std::map<irep_idt, values_innert> valuest;
   #else
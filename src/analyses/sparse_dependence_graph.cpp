@@ -0,0 +1,736 @@
+/*******************************************************************\
+
+Module: Sparse Program Dependence Graph
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Program dependence graph with data dependencies computed from def-use
+/// chains in SSA form rather than by abstract interpretation
+
+#include "sparse_dependence_graph.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include <pointer-analysis/value_set_analysis_fi.h>
+
+#include "dirty.h"
+
+static const std::size_t no_index = std::numeric_limits<std::size_t>::max();
+
+void sparse_dependence_grapht::operator()(const goto_functionst &goto_functions)
+{
+  value_set_analysis_fit value_sets(ns);
+  value_sets(goto_functions);
+
+  collect_accesses(goto_functions, value_sets);
+
+  const dirtyt dirty(goto_functions);
+  compute_summaries(goto_functions, dirty);
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    if(f_it->second.body.instructions.empty())
+      continue;
+
+    post_dominators[f_it->first](f_it->second.body);
+    add_control_dependencies(f_it->first, f_it->second.body);
+    build_ssa(f_it->first, f_it->second.body);
+  }
+
+  add_data_dependencies();
+
+  // only the graph is kept
+  instruction_info.clear();
+  versions.clear();
+  entry_versions.clear();
+  exit_versions.clear();
+  may_read.clear();
+  may_write.clear();
+  uses.clear();
+}
+
+sparse_dependence_grapht::node_indext
+sparse_dependence_grapht::get_node_id(
+  goto_programt::const_targett target) const
+{
+  const auto entry = node_ids.find(target);
+  return entry == node_ids.end() ? size() : entry->second;
+}
+
+std::size_t sparse_dependence_grapht::get_version(
+  version_mapt &version_map,
+  const irep_idt &identifier)
+{
+  const auto entry = version_map.find(identifier);
+  if(entry != version_map.end())
+    return entry->second;
+
+  const std::size_t version = new_version();
+  version_map.emplace(identifier, version);
+  return version;
+}
+
+void sparse_dependence_grapht::collect_accesses(
+  const goto_functionst &goto_functions,
+  value_setst &value_sets)
+{
+  forall_goto_functions(f_it, goto_functions)
+  {
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      const node_indext node = add_node();
+      nodes[node].PC = i_it;
+      node_ids.emplace(i_it, node);
+
+      instruction_info.emplace_back();
+      instruction_infot &info = instruction_info.back();
+
+      rw_range_set_value_sett rw_set(ns, value_sets);
+      goto_rw(f_it->first, i_it, rw_set);
+
+      forall_rw_range_set_r_objects(it, rw_set)
+      {
+        const range_domaint &ranges = rw_set.get_ranges(it);
+        info.reads.push_back(
+          {it->first, rangest(ranges.begin(), ranges.end())});
+      }
+
+      // Only these instructions define objects, just as in
+      // reaching_definitions_analysist.
+      if(!i_it->is_assign() && !i_it->is_decl() && !i_it->is_function_call())
+        continue;
+
+      forall_rw_range_set_w_objects(it, rw_set)
+      {
+        // ignore symex::invalid_object
+        const symbolt *symbol_ptr;
+        if(ns.lookup(it->first, symbol_ptr))
+          continue;
+
+        const range_domaint &ranges = rw_set.get_ranges(it);
+        info.writes.push_back(
+          {it->first, rangest(ranges.begin(), ranges.end())});
+      }
+
+      if(i_it->is_decl())
+        info.strong_update = true;
+      else if(i_it->is_assign())
+      {
+        info.strong_update = info.writes.size() == 1 &&
+                             i_it->get_assign().lhs().id() == ID_symbol;
+      }
+      else
+      {
+        const code_function_callt &call = i_it->get_function_call();
+
+        info.strong_update =
+          info.writes.size() == 1 && call.lhs().id() == ID_symbol;
+
+        if(call.function().id() == ID_symbol)
+        {
+          const irep_idt &callee =
+            to_symbol_expr(call.function()).get_identifier();
+          const auto f_entry = goto_functions.function_map.find(callee);
+          if(
+            f_entry != goto_functions.function_map.end() &&
+            f_entry->second.body_available())
+          {
+            info.callee = callee;
+          }
+        }
+      }
+    }
+  }
+}
+
+void sparse_dependence_grapht::compute_summaries(
+  const goto_functionst &goto_functions,
+  const dirtyt &dirty)
+{
+  // Other objects are local to a single invocation of a function.
+  auto is_shared = [this, &dirty](const irep_idt &identifier) {
+    const symbolt *symbol_ptr;
+    return ns.lookup(identifier, symbol_ptr) ||
+           symbol_ptr->is_static_lifetime || dirty(identifier);
+  };
+
+  std::unordered_map<irep_idt, std::unordered_set<irep_idt>> callers;
+  std::vector<irep_idt> worklist;
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    if(f_it->second.body.instructions.empty())
+      continue;
+
+    std::unordered_set<irep_idt> &reads = may_read[f_it->first];
+    std::unordered_set<irep_idt> &writes = may_write[f_it->first];
+
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      const instruction_infot &info = instruction_info[node_ids.at(i_it)];
+
+      for(const auto &read : info.reads)
+      {
+        if(is_shared(read.identifier))
+          reads.insert(read.identifier);
+      }
+
+      for(const auto &write : info.writes)
+      {
+        if(is_shared(write.identifier))
+          writes.insert(write.identifier);
+      }
+
+      if(!info.callee.empty())
+        callers[info.callee].insert(f_it->first);
+    }
+
+    worklist.push_back(f_it->first);
+  }
+
+  // propagate the summaries of callees to their callers
+  while(!worklist.empty())
+  {
+    const irep_idt callee = worklist.back();
+    worklist.pop_back();
+
+    const std::unordered_set<irep_idt> &callee_reads = may_read[callee];
+    const std::unordered_set<irep_idt> &callee_writes = may_write[callee];
+
+    for(const auto &caller : callers[callee])
+    {
+      if(caller == callee)
+        continue;
+
+      std::unordered_set<irep_idt> &reads = may_read[caller];
+      std::unordered_set<irep_idt> &writes = may_write[caller];
+      const std::size_t old_size = reads.size() + writes.size();
+
+      reads.insert(callee_reads.begin(), callee_reads.end());
+      writes.insert(callee_writes.begin(), callee_writes.end());
+
+      if(reads.size() + writes.size() != old_size)
+        worklist.push_back(caller);
+    }
+  }
+}
+
+void sparse_dependence_grapht::add_control_dependencies(
+  const irep_idt &function_id,
+  const goto_programt &body)
+{
+  // As in dep_graph_domaint::control_dependencies: a node N is control
+  // dependent on a goto or assumption M iff N post-dominates one but not
+  // all of the successors of M, where assumptions are considered to have
+  // a further successor that is post-dominated by no node.
+  const cfg_post_dominatorst &pd = post_dominators.at(function_id);
+
+  std::
+    unordered_map<goto_programt::const_targett, std::size_t, const_target_hash>
+      post_dominated;
+
+  forall_goto_program_instructions(i_it, body)
+  {
+    if(!i_it->is_goto() && !i_it->is_assume())
+      continue;
+
+    const auto e = pd.cfg.entry_map.find(i_it);
+    INVARIANT(
+      e != pd.cfg.entry_map.end(), "cfg must have an entry for every location");
+
+    const cfg_post_dominatorst::cfgt::nodet &m = pd.cfg[e->second];
+
+    post_dominated.clear();
+    for(const auto &edge : m.out)
+    {
+      for(const auto &n : pd.cfg[edge.first].dominators)
+        ++post_dominated[n];
+    }
+
+    for(const auto &n : post_dominated)
+    {
+      if(i_it->is_assume() || n.second < m.out.size())
+      {
+        add_dep(
+          dep_edget::kindt::CTRL, node_ids.at(i_it), node_ids.at(n.first));
+      }
+    }
+  }
+}
+
+void sparse_dependence_grapht::build_ssa(
+  const irep_idt &function_id,
+  const goto_programt &body)
+{
+  const node_indext first_node = node_ids.at(body.instructions.begin());
+  const std::size_t size = body.instructions.size();
+
+  std::vector<goto_programt::const_targett> targets;
+  targets.reserve(size);
+  std::vector<std::vector<std::size_t>> successors(size);
+  std::vector<std::vector<std::size_t>> predecessors(size);
+
+  forall_goto_program_instructions(i_it, body)
+  {
+    const std::size_t i = targets.size();
+    targets.push_back(i_it);
+
+    for(const auto &succ : body.get_successors(i_it))
+    {
+      const std::size_t j = node_ids.at(succ) - first_node;
+      successors[i].push_back(j);
+      predecessors[j].push_back(i);
+    }
+  }
+
+  // Order the instructions reachable from the entry in reverse post-order
+  std::vector<std::size_t> rpo;
+  std::vector<std::size_t> rpo_number(size, no_index);
+  {
+    std::vector<bool> visited(size, false);
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+    visited[0] = true;
+    stack.emplace_back(0, 0);
+
+    while(!stack.empty())
+    {
+      const std::size_t i = stack.back().first;
+      if(stack.back().second < successors[i].size())
+      {
+        const std::size_t j = successors[i][stack.back().second++];
+        if(!visited[j])
+        {
+          visited[j] = true;
+          stack.emplace_back(j, 0);
+        }
+      }
+      else
+      {
+        rpo.push_back(i);
+        stack.pop_back();
+      }
+    }
+
+    std::reverse(rpo.begin(), rpo.end());
+    for(std::size_t k = 0; k < rpo.size(); ++k)
+      rpo_number[rpo[k]] = k;
+  }
+
+  // Immediate dominators following Cooper, Harvey and Kennedy, "A Simple,
+  // Fast Dominance Algorithm"
+  std::vector<std::size_t> idom(size, no_index);
+  idom[0] = 0;
+
+  auto intersect = [&idom, &rpo_number](std::size_t a, std::size_t b) {
+    while(a != b)
+    {
+      while(rpo_number[a] > rpo_number[b])
+        a = idom[a];
+      while(rpo_number[b] > rpo_number[a])
+        b = idom[b];
+    }
+    return a;
+  };
+
+  for(bool changed = true; changed;)
+  {
+    changed = false;
+
+    for(std::size_t k = 1; k < rpo.size(); ++k)
+    {
+      const std::size_t i = rpo[k];
+      std::size_t new_idom = no_index;
+
+      for(const auto p : predecessors[i])
+      {
+        if(idom[p] == no_index)
+          continue;
+        new_idom = new_idom == no_index ? p : intersect(p, new_idom);
+      }
+
+      if(idom[i] != new_idom)
+      {
+        idom[i] = new_idom;
+        changed = true;
+      }
+    }
+  }
+
+  std::vector<std::vector<std::size_t>> dominator_tree(size);
+  for(std::size_t k = 1; k < rpo.size(); ++k)
+    dominator_tree[idom[rpo[k]]].push_back(rpo[k]);
+
+  // Dominance frontiers, where the entry of the function is a further
+  // predecessor of the first instruction that is dominated by no instruction
+  std::vector<std::vector<std::size_t>> frontier(size);
+  for(const auto i : rpo)
+  {
+    if(predecessors[i].size() + (i == 0 ? 1 : 0) < 2)
+      continue;
+
+    for(const auto p : predecessors[i])
+    {
+      if(rpo_number[p] == no_index)
+        continue;
+
+      for(std::size_t runner = p; i == 0 || runner != idom[i];
+          runner = idom[runner])
+      {
+        if(frontier[runner].empty() || frontier[runner].back() != i)
+          frontier[runner].push_back(i);
+
+        if(runner == 0)
+          break;
+      }
+    }
+  }
+
+  // The objects defined by each instruction
+  std::unordered_map<irep_idt, std::vector<std::size_t>> def_sites;
+  for(const auto i : rpo)
+  {
+    const instruction_infot &info = instruction_info[first_node + i];
+
+    for(const auto &write : info.writes)
+      def_sites[write.identifier].push_back(i);
+
+    if(targets[i]->is_dead())
+      def_sites[to_code_dead(targets[i]->code).get_identifier()].push_back(i);
+
+    if(!info.callee.empty())
+    {
+      for(const auto &identifier : may_write[info.callee])
+        def_sites[identifier].push_back(i);
+    }
+  }
+
+  // Place the phi versions at the iterated dominance frontiers
+  std::vector<std::vector<std::pair<irep_idt, std::size_t>>> phis(size);
+  {
+    std::vector<std::size_t> has_phi(size, no_index);
+    std::vector<std::size_t> added(size, no_index);
+    std::size_t object_number = 0;
+
+    for(const auto &def_site : def_sites)
+    {
+      std::vector<std::size_t> worklist = def_site.second;
+      for(const auto i : worklist)
+        added[i] = object_number;
+
+      while(!worklist.empty())
+      {
+        const std::size_t i = worklist.back();
+        worklist.pop_back();
+
+        for(const auto j : frontier[i])
+        {
+          if(has_phi[j] == object_number)
+            continue;
+
+          has_phi[j] = object_number;
+          phis[j].emplace_back(def_site.first, new_version());
+
+          if(added[j] != object_number)
+          {
+            added[j] = object_number;
+            worklist.push_back(j);
+          }
+        }
+      }
+
+      ++object_number;
+    }
+  }
+
+  // Rename along the dominator tree. The bottom of the stack of each object
+  // is its version at the entry of the function.
+  std::unordered_map<irep_idt, std::vector<std::size_t>> stacks;
+  version_mapt &entry = entry_versions[function_id];
+
+  auto top = [this, &stacks, &entry](const irep_idt &identifier) {
+    std::vector<std::size_t> &stack = stacks[identifier];
+    if(stack.empty())
+      stack.push_back(get_version(entry, identifier));
+    return stack.back();
+  };
+
+  auto define = [this, &stacks, &top](
+                  const irep_idt &identifier,
+                  std::vector<irep_idt> &pushed) {
+    top(identifier);
+    const std::size_t version = new_version();
+    stacks[identifier].push_back(version);
+    pushed.push_back(identifier);
+    return version;
+  };
+
+  struct framet
+  {
+    std::size_t instruction;
+    std::size_t next_child;
+    std::vector<irep_idt> pushed;
+  };
+
+  std::vector<framet> dfs;
+  dfs.push_back({0, 0, {}});
+
+  while(!dfs.empty())
+  {
+    const std::size_t i = dfs.back().instruction;
+
+    if(dfs.back().next_child == 0)
+    {
+      std::vector<irep_idt> &pushed = dfs.back().pushed;
+      const node_indext node = first_node + i;
+      const instruction_infot &info = instruction_info[node];
+
+      for(const auto &phi : phis[i])
+      {
+        // the entry of the function is a further predecessor
+        if(i == 0)
+        {
+          const std::size_t operand = top(phi.first);
+          versions[phi.second].operands.push_back(operand);
+        }
+
+        stacks[phi.first].push_back(phi.second);
+        pushed.push_back(phi.first);
+      }
+
+      for(std::size_t r = 0; r < info.reads.size(); ++r)
+        uses.push_back({node, r, top(info.reads[r].identifier)});
+
+      if(!info.callee.empty())
+      {
+        version_mapt &callee_entry = entry_versions[info.callee];
+        version_mapt &callee_exit = exit_versions[info.callee];
+
+        for(const auto &identifier : may_read[info.callee])
+        {
+          const std::size_t operand = top(identifier);
+          const std::size_t version = get_version(callee_entry, identifier);
+          versions[version].operands.push_back(operand);
+        }
+
+        const code_typet &callee_type =
+          to_code_type(ns.lookup(info.callee).type);
+        for(const auto &parameter : callee_type.parameters())
+        {
+          if(parameter.get_identifier().empty())
+            continue;
+
+          const std::size_t version =
+            get_version(callee_entry, parameter.get_identifier());
+          versions[version].defs.push_back(node);
+        }
+
+        // the callee may or may not have written the objects
+        for(const auto &identifier : may_write[info.callee])
+        {
+          const std::size_t before = top(identifier);
+          const std::size_t at_exit = get_version(callee_exit, identifier);
+          const std::size_t version = define(identifier, pushed);
+          versions[version].operands = {at_exit, before};
+        }
+      }
+
+      for(const auto &write : info.writes)
+      {
+        const std::size_t before = top(write.identifier);
+        const std::size_t version = define(write.identifier, pushed);
+        versions[version].defs.push_back(node);
+
+        if(!info.strong_update)
+          versions[version].operands.push_back(before);
+      }
+
+      if(targets[i]->is_dead())
+        define(to_code_dead(targets[i]->code).get_identifier(), pushed);
+
+      if(targets[i]->is_end_function())
+      {
+        version_mapt &exit = exit_versions[function_id];
+
+        for(const auto &identifier : may_write[function_id])
+        {
+          const std::size_t operand = top(identifier);
+          const std::size_t version = get_version(exit, identifier);
+          versions[version].operands.push_back(operand);
+        }
+      }
+
+      for(const auto j : successors[i])
+      {
+        for(const auto &phi : phis[j])
+        {
+          const std::size_t operand = top(phi.first);
+          versions[phi.second].operands.push_back(operand);
+        }
+      }
+    }
+
+    if(dfs.back().next_child < dominator_tree[i].size())
+    {
+      const std::size_t child = dominator_tree[i][dfs.back().next_child++];
+      dfs.push_back({child, 0, {}});
+    }
+    else
+    {
+      for(const auto &identifier : dfs.back().pushed)
+        stacks[identifier].pop_back();
+      dfs.pop_back();
+    }
+  }
+}
+
+void sparse_dependence_grapht::add_data_dependencies()
+{
+  // The definitions a version may stem from are those of all versions
+  // reachable from it. These are collected per strongly connected component
+  // of the versions, which Tarjan's algorithm yields such that the
+  // components reachable from a component precede it.
+  typedef std::vector<node_indext> defst;
+  std::vector<std::shared_ptr<const defst>> component_defs;
+
+  const std::size_t number_of_versions = versions.size();
+  std::vector<std::size_t> index(number_of_versions, no_index);
+  std::vector<std::size_t> lowlink(number_of_versions);
+  std::vector<std::size_t> component(number_of_versions, no_index);
+  std::vector<std::size_t> scc_stack;
+  std::size_t next_index = 0;
+
+  auto visit = [&](std::size_t version) {
+    index[version] = lowlink[version] = next_index++;
+    scc_stack.push_back(version);
+  };
+
+  auto add_component = [&](std::size_t root) {
+    const std::size_t c = component_defs.size();
+    std::vector<std::size_t> members;
+
+    std::size_t member;
+    do
+    {
+      member = scc_stack.back();
+      scc_stack.pop_back();
+      component[member] = c;
+      members.push_back(member);
+    } while(member != root);
+
+    defst defs;
+    std::vector<std::size_t> successors;
+
+    for(const auto m : members)
+    {
+      defs.insert(defs.end(), versions[m].defs.begin(), versions[m].defs.end());
+
+      for(const auto operand : versions[m].operands)
+      {
+        if(component[operand] != c)
+          successors.push_back(component[operand]);
+      }
+    }
+
+    std::sort(successors.begin(), successors.end());
+    successors.erase(
+      std::unique(successors.begin(), successors.end()), successors.end());
+
+    // share the definitions of versions that just pass on another one
+    if(defs.empty() && successors.size() == 1)
+    {
+      component_defs.push_back(component_defs[successors.front()]);
+      return;
+    }
+
+    for(const auto s : successors)
+    {
+      defs.insert(
+        defs.end(), component_defs[s]->begin(), component_defs[s]->end());
+    }
+
+    std::sort(defs.begin(), defs.end());
+    defs.erase(std::unique(defs.begin(), defs.end()), defs.end());
+    component_defs.push_back(std::make_shared<const defst>(std::move(defs)));
+  };
+
+  for(const auto &use : uses)
+  {
+    if(index[use.version] != no_index)
+      continue;
+
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+    visit(use.version);
+    stack.emplace_back(use.version, 0);
+
+    while(!stack.empty())
+    {
+      const std::size_t v = stack.back().first;
+      const std::vector<std::size_t> &operands = versions[v].operands;
+
+      if(stack.back().second < operands.size())
+      {
+        const std::size_t w = operands[stack.back().second++];
+
+        if(index[w] == no_index)
+        {
+          visit(w);
+          stack.emplace_back(w, 0);
+        }
+        else if(component[w] == no_index)
+          lowlink[v] = std::min(lowlink[v], index[w]);
+      }
+      else
+      {
+        stack.pop_back();
+
+        if(!stack.empty())
+        {
+          const std::size_t parent = stack.back().first;
+          lowlink[parent] = std::min(lowlink[parent], lowlink[v]);
+        }
+
+        if(lowlink[v] == index[v])
+          add_component(v);
+      }
+    }
+  }
+
+  for(const auto &use : uses)
+  {
+    const accesst &read = instruction_info[use.node].reads[use.read];
+
+    for(const auto def : *component_defs[component[use.version]])
+    {
+      // Definitions that do not record what they write, such as those of
+      // parameters at function calls, define the entire object.
+      bool found = false;
+      bool def_use_pair = true;
+
+      for(const auto &write : instruction_info[def].writes)
+      {
+        if(write.identifier != read.identifier)
+          continue;
+
+        found = true;
+        def_use_pair = false;
+
+        for(const auto &w_range : write.ranges)
+        {
+          for(const auto &r_range : read.ranges)
+          {
+            def_use_pair |= may_be_def_use_pair(
+              w_range.first, w_range.second, r_range.first, r_range.second);
+          }
+        }
+      }
+
+      if(!found || def_use_pair)
+        add_dep(dep_edget::kindt::DATA, def, use.node);
+    }
+  }
+}
@@ -0,0 +1,163 @@
+/*******************************************************************\
+
+Module: Sparse Program Dependence Graph
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Program dependence graph with data dependencies computed from def-use
+/// chains in SSA form rather than by abstract interpretation
+
+#ifndef CPROVER_ANALYSES_SPARSE_DEPENDENCE_GRAPH_H
+#define CPROVER_ANALYSES_SPARSE_DEPENDENCE_GRAPH_H
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "dependence_graph.h"
+#include "goto_rw.h"
+
+class dirtyt;
+class value_setst;
+
+/// Computes the graph that \ref dependence_grapht computes, i.e., the nodes
+/// are instructions and the edges are control and data dependencies, for
+/// programs that do not start threads.
+///
+/// Control dependencies are read off the post-dominators directly. Data
+/// dependencies are computed per function from SSA form: versions of each
+/// object are placed at the iterated dominance frontiers of its definitions
+/// and renamed along the dominator tree, which yields def-use chains
+/// without keeping the reaching definitions at each location.
+/// Functions are connected via summaries of the objects they, or the
+/// functions they call, may read and write: a call passes the versions of
+/// the objects read by the callee to its entry, and defines the objects
+/// written by the callee as their versions at its end.
+class sparse_dependence_grapht : public grapht<dep_nodet>
+{
+public:
+  typedef dependence_grapht::post_dominators_mapt post_dominators_mapt;
+
+  explicit sparse_dependence_grapht(const namespacet &_ns) : ns(_ns)
+  {
+  }
+
+  void operator()(const goto_functionst &goto_functions);
+
+  const post_dominators_mapt &cfg_post_dominators() const
+  {
+    return post_dominators;
+  }
+
+  /// \return the node of the instruction \p target, or `size()` if there is
+  ///   none
+  node_indext get_node_id(goto_programt::const_targett target) const;
+
+protected:
+  const namespacet &ns;
+
+  post_dominators_mapt post_dominators;
+
+  std::unordered_map<
+    goto_programt::const_targett,
+    node_indext,
+    const_target_hash>
+    node_ids;
+
+  typedef std::vector<std::pair<range_spect, range_spect>> rangest;
+
+  struct accesst
+  {
+    irep_idt identifier;
+    rangest ranges;
+  };
+
+  /// The objects that an instruction reads and defines
+  struct instruction_infot
+  {
+    std::vector<accesst> reads;
+    std::vector<accesst> writes;
+    /// The instruction overwrites the single object it writes entirely
+    bool strong_update = false;
+    /// The function with a body that the instruction calls, if any
+    irep_idt callee;
+  };
+
+  /// Indexed by node
+  std::vector<instruction_infot> instruction_info;
+
+  /// A version of an object in SSA form
+  struct versiont
+  {
+    /// The instructions defining this version
+    std::vector<node_indext> defs;
+    /// The versions this version may take its value from
+    std::vector<std::size_t> operands;
+  };
+
+  std::vector<versiont> versions;
+
+  std::size_t new_version()
+  {
+    versions.emplace_back();
+    return versions.size() - 1;
+  }
+
+  typedef std::unordered_map<irep_idt, std::size_t> version_mapt;
+
+  /// Get the version of \p identifier in \p version_map, creating it first
+  /// if there is none yet
+  std::size_t
+  get_version(version_mapt &version_map, const irep_idt &identifier);
+
+  /// The versions of the objects at the entry of each function
+  std::unordered_map<irep_idt, version_mapt> entry_versions;
+
+  /// The versions of the objects at the end of each function
+  std::unordered_map<irep_idt, version_mapt> exit_versions;
+
+  typedef std::unordered_map<irep_idt, std::unordered_set<irep_idt>>
+    summariest;
+
+  /// The objects of static lifetime or whose address is taken that each
+  /// function, or any function it calls, may read or write
+  summariest may_read;
+  summariest may_write;
+
+  /// A read of an object by an instruction together with the version of the
+  /// object that it reads
+  struct uset
+  {
+    node_indext node;
+    std::size_t read;
+    std::size_t version;
+  };
+
+  std::vector<uset> uses;
+
+  void collect_accesses(
+    const goto_functionst &goto_functions,
+    value_setst &value_sets);
+
+  void compute_summaries(
+    const goto_functionst &goto_functions,
+    const dirtyt &dirty);
+
+  void build_ssa(const irep_idt &function_id, const goto_programt &body);
+
+  void add_control_dependencies(
+    const irep_idt &function_id,
+    const goto_programt &body);
+
+  void add_data_dependencies();
+
+  void add_dep(dep_edget::kindt kind, node_indext from, node_indext to)
+  {
+    nodes[from].out[to].add(kind);
+    nodes[to].in[from].add(kind);
+  }
+};
+
+#endif // CPROVER_ANALYSES_SPARSE_DEPENDENCE_GRAPH_H
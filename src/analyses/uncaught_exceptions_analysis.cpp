@@ -14,6 +14,9 @@ Author: Cristina David
 #endif
 #include "uncaught_exceptions_analysis.h"
 
+#include <queue>
+#include <unordered_set>
+
 /// Returns the compile type of an exception
 irep_idt uncaught_exceptions_domaint::get_exception_type(const typet &type)
 {
@@ -170,35 +173,66 @@ void uncaught_exceptions_domaint::operator()(
   class_hierarchy(ns.get_symbol_table());
 }
 
-/// Runs the uncaught exceptions analysis, which  populates the exceptions map
+/// Runs the uncaught exceptions analysis, which  populates the exceptions map.
+/// Every function is analysed once; afterwards only the callers of a function
+/// whose estimate grew are analysed again, until a fixpoint is reached.
 void uncaught_exceptions_analysist::collect_uncaught_exceptions(
   const goto_functionst &goto_functions,
   const namespacet &ns)
 {
-  bool change=true;
+  // the reverse call graph, computed once
+  std::map<irep_idt, std::set<irep_idt>> callers;
+  std::queue<irep_idt> worklist;
+  std::unordered_set<irep_idt> in_worklist;
 
-  while(change)
+  forall_goto_functions(current_function, goto_functions)
   {
-    change=false;
-    // add all the functions to the worklist
-    forall_goto_functions(current_function, goto_functions)
+    forall_goto_program_instructions(instr_it, current_function->second.body)
     {
-      domain.make_top();
-      const goto_programt &goto_program=current_function->second.body;
-
-      if(goto_program.empty())
-        continue;
-
-      forall_goto_program_instructions(instr_it, goto_program)
+      if(instr_it->is_function_call())
       {
-        domain.transform(instr_it, *this, ns);
+        const exprt &function_expr =
+          to_code_function_call(instr_it->code).function();
+        DATA_INVARIANT(
+          function_expr.id() == ID_symbol,
+          "identifier expected to be a symbol");
+        callers[to_symbol_expr(function_expr).get_identifier()].insert(
+          current_function->first);
       }
-      // did our estimation for the current function improve?
-      const std::set<irep_idt> &elements=domain.get_elements();
-      if(exceptions_map[current_function->first].size()<elements.size())
+    }
+
+    worklist.push(current_function->first);
+    in_worklist.insert(current_function->first);
+  }
+
+  while(!worklist.empty())
+  {
+    const irep_idt function_id = worklist.front();
+    worklist.pop();
+    in_worklist.erase(function_id);
+
+    const goto_programt &goto_program =
+      goto_functions.function_map.at(function_id).body;
+
+    if(goto_program.empty())
+      continue;
+
+    domain.make_top();
+    forall_goto_program_instructions(instr_it, goto_program)
+    {
+      domain.transform(instr_it, *this, ns);
+    }
+
+    // did our estimation for the current function improve?
+    const std::set<irep_idt> &elements = domain.get_elements();
+    std::set<irep_idt> &estimate = exceptions_map[function_id];
+    if(estimate.size() < elements.size())
+    {
+      estimate = elements;
+      for(const auto &caller : callers[function_id])
       {
-        change=true;
-        exceptions_map[current_function->first]=elements;
+        if(in_worklist.insert(caller).second)
+          worklist.push(caller);
       }
     }
   }
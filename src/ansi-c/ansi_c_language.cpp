@@ -11,9 +11,15 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <cstring>
 #include <sstream>
 #include <fstream>
+#include <vector>
 
 #include <util/config.h>
+#include <util/exception_utils.h>
+#include <util/find_symbols.h>
 #include <util/get_base_name.h>
+#include <util/options.h>
+
+#include <goto-programs/goto_functions.h>
 
 #include <linking/linking.h>
 #include <linking/remove_internal_symbols.h>
@@ -31,6 +37,12 @@ std::set<std::string> ansi_c_languaget::extensions() const
   return { "c", "i" };
 }
 
+void ansi_c_languaget::set_language_options(const optionst &options)
+{
+  object_factory_params.set(options);
+  lazy_function_bodies = options.get_bool_option("lazy-function-bodies");
+}
+
 void ansi_c_languaget::modules_provided(std::set<std::string> &modules)
 {
   modules.insert(get_base_name(parse_path, true));
@@ -113,11 +125,41 @@ bool ansi_c_languaget::typecheck(
     parse_tree,
     new_symbol_table,
     module,
-    get_message_handler()))
+    get_message_handler(),
+    lazy_function_bodies))
   {
     return true;
   }
 
+  if(lazy_function_bodies)
+  {
+    std::vector<irep_idt> deferred;
+    for(const auto &named_symbol : new_symbol_table.symbols)
+    {
+      if(named_symbol.second.value.get_bool(ID_C_deferred_typecheck))
+        deferred.push_back(named_symbol.first);
+    }
+
+    // Linking renames clashing symbols of this translation unit, such as
+    // struct tags, but the renaming cannot reach into bodies that are still
+    // in parsed form. Typecheck them now, while they resolve to the
+    // symbols of their own translation unit.
+    if(linking_renames_symbols(
+         symbol_table, new_symbol_table, get_message_handler()))
+    {
+      for(const auto &id : deferred)
+      {
+        if(ansi_c_typecheck_deferred_function_body(
+             id, new_symbol_table, module, get_message_handler()))
+        {
+          return true;
+        }
+      }
+    }
+    else
+      deferred_function_bodies.insert(deferred.begin(), deferred.end());
+  }
+
   remove_internal_symbols(
     new_symbol_table, this->get_message_handler(), keep_file_local);
 
@@ -135,6 +177,100 @@ bool ansi_c_languaget::generate_support_functions(
     symbol_table, get_message_handler(), object_factory_params);
 }
 
+void ansi_c_languaget::methods_provided(
+  std::unordered_set<irep_idt> &methods) const
+{
+  methods.insert(
+    deferred_function_bodies.begin(), deferred_function_bodies.end());
+}
+
+void ansi_c_languaget::convert_lazy_method(
+  const irep_idt &function_id,
+  symbol_table_baset &symbol_table)
+{
+  if(deferred_function_bodies.erase(function_id) == 0)
+    return;
+
+  const symbolt *symbol = symbol_table.lookup(function_id);
+
+  // linking may have dropped or replaced the body
+  if(symbol == nullptr || !symbol->value.get_bool(ID_C_deferred_typecheck))
+    return;
+
+  if(ansi_c_typecheck_deferred_function_body(
+       function_id,
+       symbol_table,
+       id2string(symbol->module),
+       get_message_handler()))
+  {
+    throw invalid_source_file_exceptiont(
+      "CONVERSION ERROR in function '" + id2string(function_id) + '\'');
+  }
+}
+
+/// Typecheck those deferred function bodies (see `--lazy-function-bodies`)
+/// that are reachable from the entry point, and drop all others. This runs
+/// once for all translation units, hence the symbol table rather than
+/// \ref deferred_function_bodies is consulted.
+bool ansi_c_languaget::final(symbol_table_baset &symbol_table)
+{
+  std::unordered_set<irep_idt> deferred;
+  for(const auto &named_symbol : symbol_table.symbols)
+  {
+    if(named_symbol.second.value.get_bool(ID_C_deferred_typecheck))
+      deferred.insert(named_symbol.first);
+  }
+
+  if(deferred.empty())
+    return false;
+
+  std::vector<irep_idt> work_queue;
+
+  // without an entry point we cannot tell what is reachable
+  if(symbol_table.has_symbol(goto_functionst::entry_point()))
+    work_queue.push_back(goto_functionst::entry_point());
+  else
+    work_queue.assign(deferred.begin(), deferred.end());
+
+  std::unordered_set<irep_idt> seen(work_queue.begin(), work_queue.end());
+
+  while(!work_queue.empty())
+  {
+    const irep_idt id = work_queue.back();
+    work_queue.pop_back();
+
+    const symbolt *symbol = symbol_table.lookup(id);
+    if(symbol == nullptr)
+      continue;
+
+    if(deferred.erase(id) != 0)
+    {
+      if(ansi_c_typecheck_deferred_function_body(
+           id, symbol_table, id2string(symbol->module), get_message_handler()))
+      {
+        return true;
+      }
+    }
+
+    find_symbols_sett referenced;
+    find_symbols_or_nexts(symbol->value, referenced);
+    for(const auto &referenced_id : referenced)
+    {
+      if(seen.insert(referenced_id).second)
+        work_queue.push_back(referenced_id);
+    }
+  }
+
+  for(const auto &id : deferred)
+    symbol_table.get_writeable_ref(id).value.make_nil();
+
+  messaget log(get_message_handler());
+  log.statistics() << "Dropped " << deferred.size()
+                   << " unreachable function bodies" << messaget::eom;
+
+  return false;
+}
+
 void ansi_c_languaget::show_parse(std::ostream &out)
 {
   parse_tree.output(out);
@@ -34,10 +34,7 @@ Author: Daniel Kroening, kroening@kroening.com
 class ansi_c_languaget:public languaget
 {
 public:
-  void set_language_options(const optionst &options) override
-  {
-    object_factory_params.set(options);
-  }
+  void set_language_options(const optionst &options) override;
 
   bool preprocess(
     std::istream &instream,
@@ -102,11 +99,26 @@ public:
 
   void modules_provided(std::set<std::string> &modules) override;
 
+  void
+  methods_provided(std::unordered_set<irep_idt> &methods) const override;
+
+  void convert_lazy_method(
+    const irep_idt &function_id,
+    symbol_table_baset &symbol_table) override;
+
+  bool final(symbol_table_baset &symbol_table) override;
+
 protected:
   ansi_c_parse_treet parse_tree;
   std::string parse_path;
 
   c_object_factory_parameterst object_factory_params;
+
+  bool lazy_function_bodies = false;
+
+  /// Functions of this translation unit whose bodies have not been
+  /// typechecked yet
+  std::unordered_set<irep_idt> deferred_function_bodies;
 };
 
 std::unique_ptr<languaget> new_ansi_c_language();
@@ -73,6 +73,22 @@ void ansi_c_parsert::add_tag_with_body(irept &tag)
   }
 }
 
+void ansi_c_parsert::copy_item(ansi_c_declarationt &declaration)
+{
+  assert(declaration.id()==ID_declaration);
+  parse_tree.items.push_back(ansi_c_declarationt());
+  parse_tree.items.back().swap(declaration);
+
+  // The look-ahead token, if any, was scanned after the previous top-level
+  // declaration had been completed, hence anything below that mark can no
+  // longer be referenced by the parser.
+  for(std::size_t i=released_stack_entries; i<stack_size_at_last_item; ++i)
+    stack[i]=static_cast<const exprt &>(get_nil_irep());
+
+  released_stack_entries=stack_size_at_last_item;
+  stack_size_at_last_item=stack.size();
+}
+
 extern char *yyansi_ctext;
 
 int yyansi_cerror(const std::string &error)
@@ -33,6 +33,8 @@ public:
     : tag_following(false),
       asm_block_following(false),
       parenthesis_counter(0),
+      released_stack_entries(0),
+      stack_size_at_last_item(0),
       mode(modet::NONE),
       cpp98(false),
       cpp11(false),
@@ -43,7 +45,15 @@ public:
 
   virtual bool parse() override
   {
-    return yyansi_cparse()!=0;
+    const bool failed=yyansi_cparse()!=0;
+
+    // The entries of the last declarations are still on the parser stack
+    // and would share the nodes of the parse tree.
+    stack.clear();
+    released_stack_entries=0;
+    stack_size_at_last_item=0;
+
+    return failed;
   }
 
   virtual void clear() override
@@ -58,6 +68,8 @@ public:
     string_literal.clear();
     pragma_pack.clear();
     pragma_cprover.clear();
+    released_stack_entries=0;
+    stack_size_at_last_item=0;
 
     // set up global scope
     scopes.clear();
@@ -72,6 +84,12 @@ public:
   std::list<exprt> pragma_pack;
   std::list<std::set<irep_idt>> pragma_cprover;
 
+  // Parser stack entries below released_stack_entries have been reset to
+  // nil; stack_size_at_last_item is the size of the parser stack when the
+  // most recent top-level declaration was completed.
+  std::size_t released_stack_entries;
+  std::size_t stack_size_at_last_item;
+
   typedef configt::ansi_ct::flavourt modet;
   modet mode;
 
@@ -119,11 +137,12 @@ public:
   // adds a tag to the current scope
   void add_tag_with_body(irept &tag);
 
-  void copy_item(const ansi_c_declarationt &declaration)
-  {
-    assert(declaration.id()==ID_declaration);
-    parse_tree.items.push_back(declaration);
-  }
+  /// Move a completed top-level declaration into the parse tree, leaving
+  /// \p declaration empty. Parser stack entries belonging to earlier
+  /// top-level declarations are released, so that the parse tree holds the
+  /// only reference to its nodes and the type checker can modify them in
+  /// place without unsharing.
+  void copy_item(ansi_c_declarationt &declaration);
 
   void new_scope(const std::string &prefix)
   {
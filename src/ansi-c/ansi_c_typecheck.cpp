@@ -24,12 +24,61 @@ bool ansi_c_typecheck(
   symbol_tablet &symbol_table,
   const std::string &module,
   message_handlert &message_handler)
+{
+  return ansi_c_typecheck(
+    ansi_c_parse_tree, symbol_table, module, message_handler, false);
+}
+
+bool ansi_c_typecheck(
+  ansi_c_parse_treet &ansi_c_parse_tree,
+  symbol_tablet &symbol_table,
+  const std::string &module,
+  message_handlert &message_handler,
+  bool defer_function_bodies)
 {
   ansi_c_typecheckt ansi_c_typecheck(
     ansi_c_parse_tree, symbol_table, module, message_handler);
+  ansi_c_typecheck.defer_function_bodies=defer_function_bodies;
   return ansi_c_typecheck.typecheck_main();
 }
 
+bool ansi_c_typecheck_deferred_function_body(
+  const irep_idt &identifier,
+  symbol_table_baset &symbol_table,
+  const std::string &module,
+  message_handlert &message_handler)
+{
+  const unsigned errors_before=
+    message_handler.get_message_count(messaget::M_ERROR);
+
+  ansi_c_parse_treet ansi_c_parse_tree;
+
+  ansi_c_typecheckt ansi_c_typecheck(
+    ansi_c_parse_tree, symbol_table, module, message_handler);
+
+  try
+  {
+    ansi_c_typecheck.typecheck_deferred_function_body(identifier);
+  }
+
+  catch(int)
+  {
+    ansi_c_typecheck.error();
+  }
+
+  catch(const char *e)
+  {
+    ansi_c_typecheck.error() << e << messaget::eom;
+  }
+
+  catch(const std::string &e)
+  {
+    ansi_c_typecheck.error() << e << messaget::eom;
+  }
+
+  return message_handler.get_message_count(messaget::M_ERROR)!=errors_before;
+}
+
 bool ansi_c_typecheck(
   exprt &expr,
   message_handlert &message_handler,
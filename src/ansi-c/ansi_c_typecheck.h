@@ -21,6 +21,27 @@ bool ansi_c_typecheck(
   const std::string &module,
   message_handlert &message_handler);
 
+/// Typecheck \p parse_tree into \p symbol_table. If
+/// \p defer_function_bodies is set, the bodies of externally visible
+/// functions are left to be typechecked on demand by
+/// \ref ansi_c_typecheck_deferred_function_body.
+/// \return true on error
+bool ansi_c_typecheck(
+  ansi_c_parse_treet &parse_tree,
+  symbol_tablet &symbol_table,
+  const std::string &module,
+  message_handlert &message_handler,
+  bool defer_function_bodies);
+
+/// Typecheck the body of function \p identifier in \p symbol_table, which
+/// was deferred when its translation unit was typechecked.
+/// \return true on error
+bool ansi_c_typecheck_deferred_function_body(
+  const irep_idt &identifier,
+  symbol_table_baset &symbol_table,
+  const std::string &module,
+  message_handlert &message_handler);
+
 bool ansi_c_typecheck(
   exprt &expr,
   message_handlert &message_handler,
@@ -31,7 +52,7 @@ class ansi_c_typecheckt:public c_typecheck_baset
 public:
   ansi_c_typecheckt(
     ansi_c_parse_treet &_parse_tree,
-    symbol_tablet &_symbol_table,
+    symbol_table_baset &_symbol_table,
     const std::string &_module,
     message_handlert &_message_handler):
     c_typecheck_baset(_symbol_table, _module, _message_handler),
@@ -15,7 +15,7 @@ Author: Daniel Kroening, kroening@kroening.com
 //! \return 'true' in case of error
 bool builtin_factory(
   const irep_idt &identifier,
-  symbol_tablet &,
+  symbol_table_baset &,
   message_handlert &);
 
 #endif // CPROVER_ANSI_C_BUILTIN_FACTORY_H
@@ -13,6 +13,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/c_types.h>
 #include <util/config.h>
+#include <util/expr_iterator.h>
 #include <util/invariant.h>
 #include <util/prefix.h>
 #include <util/std_types.h>
@@ -502,16 +503,9 @@ void c_typecheck_baset::typecheck_function_body(symbolt &symbol)
 
   assert(symbol.value.is_not_nil());
 
-  // reset labels
-  labels_used.clear();
-  labels_defined.clear();
-
   // fix type
   symbol.value.type()=code_type;
 
-  // set return type
-  return_type=code_type.return_type();
-
   unsigned anon_counter=0;
 
   // Add the parameter declarations into the symbol table.
@@ -541,6 +535,25 @@ void c_typecheck_baset::typecheck_function_body(symbolt &symbol)
     move_symbol(p_symbol, new_p_symbol);
   }
 
+  if(defer_function_bodies && can_defer_function_body(symbol))
+  {
+    // parameters are in place, the body is typechecked on demand
+    symbol.value.set(ID_C_deferred_typecheck, true);
+    return;
+  }
+
+  typecheck_function_code(symbol);
+}
+
+void c_typecheck_baset::typecheck_function_code(symbolt &symbol)
+{
+  // reset labels
+  labels_used.clear();
+  labels_defined.clear();
+
+  // set return type
+  return_type=to_code_type(symbol.type).return_type();
+
   // typecheck the body code
   typecheck_code(to_code(symbol.value));
 
@@ -557,6 +570,46 @@ void c_typecheck_baset::typecheck_function_body(symbolt &symbol)
   }
 }
 
+/// Determine whether typechecking the body of function \p symbol can be
+/// postponed until the function is actually needed. Bodies that introduce
+/// objects of static or thread storage duration must be typechecked before
+/// the initialization code is generated, and file-local as well as inline
+/// functions may be renamed or discarded during linking.
+bool c_typecheck_baset::can_defer_function_body(const symbolt &symbol) const
+{
+  if(symbol.is_file_local || to_code_type(symbol.type).get_inlined())
+    return false;
+
+  for(auto it = symbol.value.depth_begin(); it != symbol.value.depth_end();
+      ++it)
+  {
+    if(it->id() == ID_declaration)
+    {
+      const c_storage_spect storage_spec(it->type());
+      if(storage_spec.is_static || storage_spec.is_thread_local)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+void c_typecheck_baset::typecheck_deferred_function_body(
+  const irep_idt &identifier)
+{
+  symbolt &symbol = symbol_table.get_writeable_ref(identifier);
+  PRECONDITION(symbol.value.get_bool(ID_C_deferred_typecheck));
+
+  symbol.value.remove(ID_C_deferred_typecheck);
+
+  // the type may have been adjusted during linking
+  symbol.value.type() = symbol.type;
+
+  current_symbol = symbol;
+  start_typecheck_code();
+  typecheck_function_code(symbol);
+}
+
 void c_typecheck_baset::apply_asm_label(
   const irep_idt &asm_label,
   symbolt &symbol)
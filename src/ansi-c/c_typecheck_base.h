@@ -28,11 +28,12 @@ class c_typecheck_baset:
 {
 public:
   c_typecheck_baset(
-    symbol_tablet &_symbol_table,
+    symbol_table_baset &_symbol_table,
     const std::string &_module,
     message_handlert &_message_handler):
     typecheckt(_message_handler),
     namespacet(_symbol_table),
+    defer_function_bodies(false),
     symbol_table(_symbol_table),
     module(_module),
     mode(ID_C),
@@ -43,12 +44,13 @@ public:
   }
 
   c_typecheck_baset(
-    symbol_tablet &_symbol_table1,
-    const symbol_tablet &_symbol_table2,
+    symbol_table_baset &_symbol_table1,
+    const symbol_table_baset &_symbol_table2,
     const std::string &_module,
     message_handlert &_message_handler):
     typecheckt(_message_handler),
     namespacet(_symbol_table1, _symbol_table2),
+    defer_function_bodies(false),
     symbol_table(_symbol_table1),
     module(_module),
     mode(ID_C),
@@ -63,8 +65,20 @@ public:
   virtual void typecheck()=0;
   virtual void typecheck_expr(exprt &expr);
 
+  /// Typecheck the body of function \p identifier, which must have been
+  /// deferred while typechecking its translation unit (see
+  /// \ref defer_function_bodies).
+  void typecheck_deferred_function_body(const irep_idt &identifier);
+
+  /// When set, bodies of externally visible functions are left in their
+  /// parsed form and marked with `ID_C_deferred_typecheck`; only their
+  /// declarations and parameters are typechecked. Functions that are file
+  /// local or inline, or that declare objects of static or thread storage
+  /// duration, are always typechecked eagerly.
+  bool defer_function_bodies;
+
 protected:
-  symbol_tablet &symbol_table;
+  symbol_table_baset &symbol_table;
   const irep_idt module;
   const irep_idt mode;
   symbolt current_symbol;
@@ -249,6 +263,8 @@ protected:
   void typecheck_redefinition_non_type(
     symbolt &old_symbol, symbolt &new_symbol);
   void typecheck_function_body(symbolt &symbol);
+  void typecheck_function_code(symbolt &symbol);
+  bool can_defer_function_body(const symbolt &symbol) const;
 
   virtual void do_initializer(symbolt &symbol);
 
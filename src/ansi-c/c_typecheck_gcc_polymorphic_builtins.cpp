@@ -598,7 +598,7 @@ static symbolt result_symbol(
   const irep_idt &identifier,
   const typet &type,
   const source_locationt &source_location,
-  symbol_tablet &symbol_table)
+  symbol_table_baset &symbol_table)
 {
   symbolt symbol;
   symbol.name = id2string(identifier) + "::1::result";
@@ -621,7 +621,7 @@ static void instantiate_atomic_fetch_op(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // type __sync_fetch_and_OP(type *ptr, type value, ...)
@@ -683,7 +683,7 @@ static void instantiate_atomic_op_fetch(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // type __sync_OP_and_fetch(type *ptr, type value, ...)
@@ -796,7 +796,7 @@ static void instantiate_sync_val_compare_and_swap(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // type __sync_val_compare_and_swap(type *ptr, type old, type new, ...)
@@ -846,7 +846,7 @@ static void instantiate_sync_lock_test_and_set(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // type __sync_lock_test_and_set (type *ptr, type value, ...)
@@ -975,7 +975,7 @@ static void instantiate_atomic_load_n(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // type __atomic_load_n (type *ptr, int memorder)
@@ -1090,7 +1090,7 @@ static void instantiate_atomic_exchange_n(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // type __atomic_exchange_n (type *ptr, type val, int memorder)
@@ -1120,7 +1120,7 @@ static void instantiate_atomic_compare_exchange(
   const code_typet &code_type,
   const source_locationt &source_location,
   const std::vector<symbol_exprt> &parameter_exprs,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   code_blockt &block)
 {
   // bool __atomic_compare_exchange (type *ptr, type *expected, type *desired,
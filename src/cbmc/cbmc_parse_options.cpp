@@ -39,9 +39,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-checker/all_properties_verifier_with_trace_storage.h>
 #include <goto-checker/bmc_util.h>
 #include <goto-checker/cover_goals_verifier_with_trace_storage.h>
+#include <goto-checker/k_induction_symex_checker.h>
 #include <goto-checker/multi_path_symex_checker.h>
 #include <goto-checker/multi_path_symex_only_checker.h>
 #include <goto-checker/properties.h>
+#include <goto-checker/single_loop_incremental_symex_checker.h>
 #include <goto-checker/single_path_symex_checker.h>
 #include <goto-checker/single_path_symex_only_checker.h>
 #include <goto-checker/stop_on_fail_verifier.h>
@@ -136,6 +138,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   cbmc_parse_optionst::set_default_options(options);
   parse_c_object_factory_options(cmdline, options);
 
+  if(cmdline.isset("lazy-function-bodies"))
+    options.set_option("lazy-function-bodies", true);
+
   if(cmdline.isset("function"))
     options.set_option("function", cmdline.get_value("function"));
 
@@ -295,6 +300,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("partial-loops"))
     options.set_option("partial-loops", true);
 
+  if(cmdline.isset("accelerate-loops"))
+    options.set_option("accelerate-loops", true);
+
   // remove unused equations
   if(cmdline.isset("slice-formula"))
     options.set_option("slice-formula", true);
@@ -413,6 +421,32 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("no-sat-preprocessor"))
     options.set_option("sat-preprocessor", false);
 
+  if(cmdline.isset("incremental-check"))
+  {
+    if(cmdline.isset("paths") || cmdline.isset("cover"))
+    {
+      log.error() << "--incremental-check must not be given together with "
+                  << "--paths or --cover" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "incremental-check", cmdline.get_value("incremental-check"));
+
+    if(cmdline.isset("unwind-min"))
+      options.set_option("unwind-min", cmdline.get_value("unwind-min"));
+
+    if(cmdline.isset("unwind-max"))
+      options.set_option("unwind-max", cmdline.get_value("unwind-max"));
+
+    if(cmdline.isset("stop-when-unsat"))
+      options.set_option("stop-when-unsat", true);
+
+    // The SAT preprocessor may eliminate variables that the steps of
+    // later unwindings refer to.
+    options.set_option("sat-preprocessor", false);
+  }
+
   if(cmdline.isset("no-pretty-names"))
     options.set_option("pretty-names", false);
 
@@ -631,6 +665,38 @@ int cbmc_parse_optionst::doit()
   std::unique_ptr<goto_verifiert> verifier = nullptr;
 
   if(
+    options.get_bool_option("stop-on-fail") &&
+    options.get_bool_option("stop-when-unsat"))
+  {
+    verifier =
+      util_make_unique<stop_on_fail_verifiert<k_induction_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+  }
+  else if(
+    !options.get_bool_option("stop-on-fail") &&
+    options.get_bool_option("stop-when-unsat"))
+  {
+    verifier = util_make_unique<
+      all_properties_verifier_with_trace_storaget<k_induction_symex_checkert>>(
+      options, ui_message_handler, goto_model);
+  }
+  else if(
+    options.get_bool_option("stop-on-fail") &&
+    options.is_set("incremental-check"))
+  {
+    verifier = util_make_unique<
+      stop_on_fail_verifiert<single_loop_incremental_symex_checkert>>(
+      options, ui_message_handler, goto_model);
+  }
+  else if(
+    !options.get_bool_option("stop-on-fail") &&
+    options.is_set("incremental-check"))
+  {
+    verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
+      single_loop_incremental_symex_checkert>>(
+      options, ui_message_handler, goto_model);
+  }
+  else if(
     options.get_bool_option("stop-on-fail") && options.get_bool_option("paths"))
   {
     verifier =
@@ -980,6 +1046,8 @@ void cbmc_parse_optionst::help()
     #endif
     " --no-arch                    don't set up an architecture\n"
     " --no-library                 disable built-in abstract C library\n"
+    " --lazy-function-bodies       only type-check C function bodies that are\n"
+    "                              reachable from the entry point\n"
     " --round-to-nearest           rounding towards nearest even (default)\n"
     " --round-to-plus-inf          rounding towards plus infinity\n"
     " --round-to-minus-inf         rounding towards minus infinity\n"
@@ -1010,6 +1078,13 @@ void cbmc_parse_optionst::help()
     "\n"
     "BMC options:\n"
     HELP_BMC
+    " --incremental-check L        check properties after each unwinding\n"
+    "                              of loop L and stop unwinding it once\n"
+    "                              its unwinding assertion holds\n"
+    " --unwind-min nr              unwind loop L nr times before checking\n"
+    " --unwind-max nr              unwind loop L at most nr times\n"
+    " --stop-when-unsat            prove the properties of loop L by\n"
+    "                              k-induction while unwinding it\n"
     "\n"
     "Backend options:\n"
     " --object-bits n              number of bits used for object addresses\n"
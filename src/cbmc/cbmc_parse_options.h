@@ -65,7 +65,8 @@ class optionst;
   "(show-symbol-table)(show-parse-tree)" \
   "(drop-unused-functions)" \
   "(property):(stop-on-fail)(trace)" \
-  "(error-label):(verbosity):(no-library)" \
+  "(incremental-check):(unwind-min):(unwind-max)(stop-when-unsat)" \
+  "(error-label):(verbosity):(no-library)(lazy-function-bodies)" \
   "(nondet-static)" \
   "(version)" \
   "(cover):(symex-coverage-report):" \
@@ -15,6 +15,8 @@ Author: Daniel Kroening, kroening@cs.cmu.edu
 #include <iostream>
 #endif
 
+#include <algorithm>
+
 #include <util/arith_tools.h>
 #include <util/base_exceptions.h>
 #include <util/simplify_expr.h>
@@ -23,6 +25,28 @@ Author: Daniel Kroening, kroening@cs.cmu.edu
 
 #include "cpp_type2name.h"
 
+namespace
+{
+/// Adds the time spent in the enclosing scope to a running total.
+class scoped_timert
+{
+public:
+  explicit scoped_timert(std::chrono::duration<double> &_total)
+    : total(_total), start(std::chrono::steady_clock::now())
+  {
+  }
+
+  ~scoped_timert()
+  {
+    total += std::chrono::steady_clock::now() - start;
+  }
+
+private:
+  std::chrono::duration<double> &total;
+  std::chrono::steady_clock::time_point start;
+};
+} // namespace
+
 std::string cpp_typecheckt::template_suffix(
   const cpp_template_args_tct &template_args)
 {
@@ -112,6 +136,46 @@ void cpp_typecheckt::show_instantiation_stack(std::ostream &out)
   }
 }
 
+const symbolt &cpp_typecheckt::cache_instantiation(
+  const instantiation_cachet::key_type &key,
+  const symbolt &instance)
+{
+  instantiation_cache[key] = instance.name;
+  return instance;
+}
+
+void cpp_typecheckt::show_instantiation_statistics()
+{
+  if(instantiation_statistics.empty())
+    return;
+
+  typedef std::pair<irep_idt, instantiation_statisticst> entryt;
+  std::vector<entryt> entries(
+    instantiation_statistics.begin(), instantiation_statistics.end());
+  std::sort(
+    entries.begin(), entries.end(), [](const entryt &a, const entryt &b) {
+      return a.second.runtime > b.second.runtime;
+    });
+
+  std::size_t instantiations = 0, reuses = 0;
+  for(const auto &entry : entries)
+  {
+    instantiations += entry.second.instantiations;
+    reuses += entry.second.reuses;
+  }
+
+  statistics() << "Template instantiations: " << instantiations << " of "
+               << entries.size() << " templates, " << reuses << " reused"
+               << eom;
+
+  for(const auto &entry : entries)
+  {
+    debug() << "  " << entry.first << ": " << entry.second.instantiations
+            << " instantiated, " << entry.second.reuses << " reused, "
+            << entry.second.runtime.count() << "s" << eom;
+  }
+}
+
 /// Set up a scope as subscope of the template scope
 cpp_scopet &cpp_typecheckt::sub_scope_for_instantiation(
   cpp_scopet &template_scope,
@@ -269,6 +333,10 @@ const symbolt &cpp_typecheckt::instantiate_template(
     throw 0;
   }
 
+  instantiation_statisticst &template_statistics =
+    instantiation_statistics[template_symbol.name];
+  scoped_timert timer(template_statistics.runtime);
+
   instantiation_levelt i_level(instantiation_stack);
   instantiation_stack.back().source_location=source_location;
   instantiation_stack.back().identifier=template_symbol.name;
@@ -313,6 +381,27 @@ const symbolt &cpp_typecheckt::instantiate_template(
   // produce new symbol name
   std::string suffix=template_suffix(full_template_args);
 
+  // have we completed this instantiation before?
+  const instantiation_cachet::key_type cache_key(template_symbol.name, suffix);
+  {
+    instantiation_cachet::const_iterator entry =
+      instantiation_cache.find(cache_key);
+
+    if(entry != instantiation_cache.end())
+    {
+      const symbolt *instance = symbol_table.lookup(entry->second);
+
+      if(
+        instance != nullptr &&
+        ((instance->is_type && instance->type.id() == ID_struct) ||
+         instance->value.is_not_nil()))
+      {
+        ++template_statistics.reuses;
+        return *instance;
+      }
+    }
+  }
+
   // we need the template scope to see the template parameters
   cpp_scopet *template_scope=
     static_cast<cpp_scopet *>(cpp_scopes.id_map[template_symbol.name]);
@@ -375,16 +464,21 @@ const symbolt &cpp_typecheckt::instantiate_template(
       const symbolt &symb=lookup(cpp_id.identifier);
 
       // continue if the type is incomplete only
-      if(cpp_id.id_class==cpp_idt::id_classt::CLASS &&
-         symb.type.id()==ID_struct)
-        return symb;
-      else if(symb.value.is_not_nil())
-        return symb;
+      if(
+        (cpp_id.id_class == cpp_idt::id_classt::CLASS &&
+         symb.type.id() == ID_struct) ||
+        symb.value.is_not_nil())
+      {
+        ++template_statistics.reuses;
+        return cache_instantiation(cache_key, symb);
+      }
     }
 
     cpp_scopes.go_to(sub_scope);
   }
 
+  ++template_statistics.instantiations;
+
   // store the information that the template has
   // been instantiated using these arguments
   {
@@ -476,7 +570,7 @@ const symbolt &cpp_typecheckt::instantiate_template(
     std::cout << "template type: " << template_type.pretty() << "\n\n";
 #endif
 
-    return new_symb;
+    return cache_instantiation(cache_key, new_symb);
   }
 
   if(is_template_method)
@@ -527,7 +621,9 @@ const symbolt &cpp_typecheckt::instantiate_template(
       false,
       false);
 
-    return lookup(to_struct_type(symb.type).components().back().get_name());
+    return cache_instantiation(
+      cache_key,
+      lookup(to_struct_type(symb.type).components().back().get_name()));
   }
 
   // not a class template, not a class template method,
@@ -540,5 +636,5 @@ const symbolt &cpp_typecheckt::instantiate_template(
   const symbolt &symb=
     lookup(new_decl.declarators()[0].get(ID_identifier));
 
-  return symb;
+  return cache_instantiation(cache_key, symb);
 }
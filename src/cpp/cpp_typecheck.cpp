@@ -61,6 +61,8 @@ void cpp_typecheckt::typecheck()
   do_not_typechecked();
 
   clean_up();
+
+  show_instantiation_statistics();
 }
 
 const struct_typet &cpp_typecheckt::this_struct_type()
@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@cs.cmu.edu
 #ifndef CPROVER_CPP_CPP_TYPECHECK_H
 #define CPROVER_CPP_CPP_TYPECHECK_H
 
+#include <chrono>
 #include <list>
 #include <map>
 #include <set>
@@ -202,6 +203,29 @@ protected:
     instantiation_stackt &instantiation_stack;
   };
 
+  /// Completed template instantiations, mapping the template symbol and the
+  /// canonicalized argument list (see \ref template_suffix) to the
+  /// identifier of the instance
+  typedef std::map<std::pair<irep_idt, std::string>, irep_idt>
+    instantiation_cachet;
+  instantiation_cachet instantiation_cache;
+
+  const symbolt &cache_instantiation(
+    const instantiation_cachet::key_type &key,
+    const symbolt &instance);
+
+  struct instantiation_statisticst
+  {
+    std::size_t instantiations = 0;
+    std::size_t reuses = 0;
+    /// time spent instantiating, including nested instantiations
+    std::chrono::duration<double> runtime{0};
+  };
+
+  std::map<irep_idt, instantiation_statisticst> instantiation_statistics;
+
+  void show_instantiation_statistics();
+
   const symbolt &class_template_symbol(
     const source_locationt &source_location,
     const symbolt &template_symbol,
@@ -13,7 +13,10 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include <fstream>
 #include <iostream>
+#include <unordered_set>
+#include <vector>
 
+#include <goto-programs/goto_functions.h>
 #include <goto-programs/graphml_witness.h>
 #include <goto-programs/json_goto_trace.h>
 #include <goto-programs/xml_goto_trace.h>
@@ -287,6 +290,77 @@ void update_status_of_not_checked_properties(
   }
 }
 
+void update_status_of_unreachable_properties(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties,
+  const goto_functionst &goto_functions)
+{
+  const auto entry_it =
+    goto_functions.function_map.find(goto_functionst::entry_point());
+  if(
+    entry_it == goto_functions.function_map.end() ||
+    !entry_it->second.body_available())
+  {
+    return;
+  }
+
+  typedef std::pair<const goto_programt *, goto_programt::const_targett>
+    locationt;
+  std::unordered_set<const goto_programt::instructiont *> reached;
+  std::vector<locationt> worklist;
+
+  auto enter = [&](const goto_programt &body) {
+    if(
+      !body.instructions.empty() &&
+      reached.insert(&body.instructions.front()).second)
+    {
+      worklist.emplace_back(&body, body.instructions.begin());
+    }
+  };
+
+  enter(entry_it->second.body);
+
+  while(!worklist.empty())
+  {
+    const goto_programt &body = *worklist.back().first;
+    const goto_programt::const_targett target = worklist.back().second;
+    worklist.pop_back();
+
+    if(target->is_throw())
+      return;
+
+    if(target->is_function_call())
+    {
+      const exprt &function = target->get_function_call().function();
+      if(function.id() != ID_symbol)
+        return;
+
+      const auto callee_it = goto_functions.function_map.find(
+        to_symbol_expr(function).get_identifier());
+      if(callee_it != goto_functions.function_map.end())
+        enter(callee_it->second.body);
+    }
+
+    for(const auto &successor : body.get_successors(target))
+    {
+      if(reached.insert(&*successor).second)
+        worklist.emplace_back(&body, successor);
+    }
+  }
+
+  for(auto &property_pair : properties)
+  {
+    if(
+      property_pair.second.status == property_statust::NOT_CHECKED &&
+      reached.count(&*property_pair.second.pc) == 0)
+    {
+      // The goal cannot be covered, nor the property be violated.
+      property_pair.second.status = property_statust::PASS;
+      updated_properties.insert(property_pair.first);
+    }
+  }
+}
+
 void update_status_of_unknown_properties(
   propertiest &properties,
   std::unordered_set<irep_idt> &updated_properties)
@@ -23,6 +23,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include "properties.h"
 
 class decision_proceduret;
+class goto_functionst;
 class goto_symex_property_decidert;
 class goto_tracet;
 class memory_model_baset;
@@ -127,6 +128,20 @@ void update_status_of_not_checked_properties(
   propertiest &properties,
   std::unordered_set<irep_idt> &updated_properties);
 
+/// Sets the property status of NOT_CHECKED properties to PASS whose
+/// instructions cannot be reached from the entry point in the interprocedural
+/// control-flow graph of \p goto_functions. Programs with calls via function
+/// pointers or with exceptions are left alone, as their control flow is not
+/// explicit.
+/// \param [in,out] properties: The status is updated in this data structure
+/// \param [in,out] updated_properties: The IDs of updated properties are
+///   added here
+/// \param goto_functions: The functions the properties refer to
+void update_status_of_unreachable_properties(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties,
+  const goto_functionst &goto_functions);
+
 /// Sets the property status of UNKNOWN properties to PASS.
 /// \param [in,out] properties: The status is updated in this data structure
 /// \param [in,out] updated_properties: The set of property IDs of
@@ -182,6 +197,7 @@ void run_property_decider(
   "(no-pretty-names)" \
   "(no-self-loops-to-assumptions)" \
   "(partial-loops)" \
+  "(accelerate-loops)" \
   "(paths):" \
   "(show-symex-strategies)" \
   "(depth):" \
@@ -206,6 +222,8 @@ void run_property_decider(
   " --unwinding-assertions       generate unwinding assertions (cannot be\n" \
   "                              used with --cover or --partial-loops)\n" \
   " --partial-loops              permit paths with partial loops\n" \
+  " --accelerate-loops           execute simple counting loops in one step\n" \
+  "                              instead of unwinding them\n" \
   " --no-self-loops-to-assumptions\n" \
   "                              do not simplify while(1){} to assume(0)\n" \
   " --no-pretty-names            do not simplify identifiers\n" \
@@ -12,6 +12,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include "cover_goals_report_util.h"
 
 #include <iomanip>
+#include <sstream>
 
 #include <util/json.h>
 #include <util/json_irep.h>
@@ -26,13 +27,14 @@ static void output_goals_iterations(
 {
   const std::size_t goals_covered =
     count_properties(properties, property_statust::FAIL);
+  // formatted separately, as flags set on the message stream would persist
+  std::ostringstream percentage;
+  percentage << std::fixed << std::setw(1) << std::setprecision(1)
+             << (properties.empty()
+                   ? 100.0
+                   : 100.0 * goals_covered / properties.size());
   log.status() << "** " << goals_covered << " of " << properties.size()
-               << " covered (" << std::fixed << std::setw(1)
-               << std::setprecision(1)
-               << (properties.empty()
-                     ? 100.0
-                     : 100.0 * goals_covered / properties.size())
-               << "%)" << messaget::eom;
+               << " covered (" << percentage.str() << "%)" << messaget::eom;
   log.statistics() << "** Used " << iterations << " iteration"
                    << (iterations == 1 ? "" : "s") << messaget::eom;
 }
@@ -114,6 +116,22 @@ static void output_goals_json(
     "totalGoals", json_numbert(std::to_string(properties.size())));
 }
 
+std::size_t output_goals_progress(
+  const propertiest &properties,
+  std::size_t previously_covered,
+  std::chrono::duration<double> runtime,
+  messaget &log)
+{
+  const std::size_t goals_covered =
+    count_properties(properties, property_statust::FAIL);
+  std::ostringstream seconds;
+  seconds << std::fixed << std::setprecision(1) << runtime.count();
+  log.status() << "Covered " << goals_covered << " of " << properties.size()
+               << " goals (+" << goals_covered - previously_covered
+               << ") after " << seconds.str() << "s" << messaget::eom;
+  return goals_covered;
+}
+
 void output_goals(
   const propertiest &properties,
   unsigned iterations,
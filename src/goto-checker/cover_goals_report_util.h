@@ -12,8 +12,11 @@ Author: Daniel Kroening, Peter Schrammel
 #ifndef CPROVER_GOTO_CHECKER_COVER_GOALS_REPORT_UTIL_H
 #define CPROVER_GOTO_CHECKER_COVER_GOALS_REPORT_UTIL_H
 
+#include <chrono>
+
 #include "properties.h"
 
+class messaget;
 class ui_message_handlert;
 
 /// Outputs the \p properties interpreted as 'coverage goals'
@@ -24,4 +27,14 @@ void output_goals(
   unsigned iterations,
   ui_message_handlert &ui_message_handler);
 
+/// Outputs how many of the \p properties, interpreted as 'coverage goals',
+/// are covered after \p runtime, and how many of those have been covered
+/// since the number \p previously_covered was output
+/// \return the number of covered goals
+std::size_t output_goals_progress(
+  const propertiest &properties,
+  std::size_t previously_covered,
+  std::chrono::duration<double> runtime,
+  messaget &log);
+
 #endif // CPROVER_GOTO_CHECKER_COVER_GOALS_REPORT_UTIL_H
@@ -14,6 +14,9 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "goto_verifier.h"
 
+#include <chrono>
+#include <unordered_set>
+
 #include "bmc_util.h"
 #include "cover_goals_report_util.h"
 #include "goto_trace_storage.h"
@@ -38,6 +41,23 @@ public:
 
   resultt operator()() override
   {
+    // Goals that cannot be reached in the control-flow graph are never
+    // covered, so we don't ask the solver about them.
+    std::unordered_set<irep_idt> retired_goals;
+    update_status_of_unreachable_properties(
+      properties, retired_goals, goto_model.get_goto_functions());
+    if(!retired_goals.empty())
+    {
+      log.status() << "Retired " << retired_goals.size()
+                   << " goals unreachable in the control-flow graph"
+                   << messaget::eom;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t goals_covered = 0;
+
+    // Each iteration solves for the disjunction of the uncovered goals and
+    // harvests all goals that are covered by the model found.
     while(incremental_goto_checker(properties).progress !=
           incremental_goto_checkert::resultt::progresst::DONE)
     {
@@ -46,6 +66,12 @@ public:
       (void)traces.insert_all(incremental_goto_checker.build_full_trace());
 
       ++iterations;
+
+      goals_covered = output_goals_progress(
+        properties,
+        goals_covered,
+        std::chrono::steady_clock::now() - start,
+        log);
     }
 
     return determine_result(properties);
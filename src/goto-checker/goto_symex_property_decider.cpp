@@ -43,12 +43,17 @@ exprt goto_symex_property_decidert::goalt::as_expr() const
 void goto_symex_property_decidert::
   update_properties_goals_from_symex_target_equation(propertiest &properties)
 {
+  // Goals are built over the assertions converted by the last conversion of
+  // the equation only, as incremental checkers convert it repeatedly.
+  goal_map.clear();
+
   for(symex_target_equationt::SSA_stepst::iterator it =
         equation.SSA_steps.begin();
       it != equation.SSA_steps.end();
       ++it)
   {
-    if(it->is_assert())
+    // Assertions converted by an earlier conversion are ignored.
+    if(it->is_assert() && !it->ignore)
     {
       irep_idt property_id = it->get_property_id();
       CHECK_RETURN(!property_id.empty());
@@ -30,7 +30,8 @@ public:
     const namespacet &ns);
 
   /// Get the conditions for the properties from the equation
-  /// and collect all 'instances' of the properties in the `goal_map`
+  /// and collect all 'instances' of the properties in the `goal_map`,
+  /// replacing those collected by earlier calls
   void
   update_properties_goals_from_symex_target_equation(propertiest &properties);
 
@@ -0,0 +1,328 @@
+/*******************************************************************\
+
+Module: Goto Checker using k-Induction
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using incremental k-induction over a single loop
+
+#include "k_induction_symex_checker.h"
+
+#include <util/std_code.h>
+
+#include <solvers/prop/prop.h>
+
+#include "bmc_util.h"
+
+/// The inductive step checks a single further iteration each time, while
+/// \p options may ask for the properties to be checked from a later
+/// unwinding on
+static optionst step_case_options(const optionst &options)
+{
+  optionst step_options = options;
+  step_options.set_option("unwind-min", 0);
+  return step_options;
+}
+
+k_induction_symex_checkert::k_induction_symex_checkert(
+  const optionst &options,
+  ui_message_handlert &ui_message_handler,
+  abstract_goto_modelt &goto_model)
+  : single_loop_incremental_symex_checkert(
+      options,
+      ui_message_handler,
+      goto_model),
+    step_ns(goto_model.get_symbol_table(), step_symex_symbol_table),
+    step_equation(ui_message_handler),
+    step_symex(
+      ui_message_handler,
+      goto_model.get_symbol_table(),
+      step_equation,
+      step_case_options(options),
+      step_path_storage,
+      step_guard_manager)
+{
+  setup_symex(step_symex, step_ns, options, ui_message_handler);
+
+  solver_factoryt solvers(
+    options,
+    step_ns,
+    ui_message_handler,
+    ui_message_handler.get_ui() == ui_message_handlert::uit::XML_UI);
+  step_solver = solvers.get_solver();
+
+  setup_step_case();
+}
+
+/// Collect the symbol that \p lhs writes to
+/// \return false if the object written to is not known syntactically
+static bool
+get_modified_symbol(const exprt &lhs, std::vector<symbol_exprt> &modifies)
+{
+  if(lhs.id() == ID_symbol)
+  {
+    modifies.push_back(to_symbol_expr(lhs));
+    return true;
+  }
+  else if(lhs.id() == ID_index)
+    return get_modified_symbol(to_index_expr(lhs).array(), modifies);
+  else if(lhs.id() == ID_member)
+    return get_modified_symbol(to_member_expr(lhs).struct_op(), modifies);
+  else if(lhs.id() == ID_typecast)
+    return get_modified_symbol(to_typecast_expr(lhs).op(), modifies);
+  else
+    return false;
+}
+
+void k_induction_symex_checkert::setup_step_case()
+{
+  messaget log(ui_message_handler);
+  const irep_idt &loop_id = symex.incremental_loop_id;
+  const goto_functionst &goto_functions = goto_model.get_goto_functions();
+
+  irep_idt loop_function_id;
+  goto_programt::const_targett loop_head, loop_back_edge;
+  bool found = false;
+
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    forall_goto_program_instructions(it, gf_entry.second.body)
+    {
+      if(
+        it->is_backwards_goto() &&
+        goto_programt::loop_id(gf_entry.first, *it) == loop_id)
+      {
+        loop_function_id = gf_entry.first;
+        loop_head = it->get_target();
+        loop_back_edge = it;
+        found = true;
+      }
+    }
+  }
+
+  if(!found)
+  {
+    log.warning() << "loop " << loop_id << " not found, skipping inductive step"
+                  << messaget::eom;
+    return;
+  }
+
+  auto not_applicable = [&log, &loop_id](const std::string &reason) {
+    log.warning() << "inductive step not applicable to loop " << loop_id
+                  << ": " << reason << messaget::eom;
+  };
+
+  // The inductive step havocs the loop when it is entered, and thus needs
+  // it to be entered at most once.
+  if(loop_function_id == goto_functionst::entry_point())
+  {
+    not_applicable("loop in entry point");
+    return;
+  }
+
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    forall_goto_program_instructions(it, gf_entry.second.body)
+    {
+      if(
+        it->is_function_call() &&
+        it->get_function_call().function().id() == ID_symbol &&
+        to_symbol_expr(it->get_function_call().function()).get_identifier() ==
+          loop_function_id &&
+        gf_entry.first != goto_functionst::entry_point())
+      {
+        not_applicable(
+          "function " + id2string(loop_function_id) + " is called by " +
+          id2string(gf_entry.first));
+        return;
+      }
+    }
+  }
+
+  const goto_programt &body =
+    goto_functions.function_map.at(loop_function_id).body;
+  forall_goto_program_instructions(it, body)
+  {
+    if(
+      it->is_backwards_goto() && it != loop_back_edge &&
+      it->get_target()->location_number <= loop_head->location_number &&
+      it->location_number >= loop_back_edge->location_number)
+    {
+      not_applicable(
+        "nested in loop " +
+        id2string(goto_programt::loop_id(loop_function_id, *it)));
+      return;
+    }
+  }
+
+  // Collect what the loop may modify and which properties it contains
+  std::vector<symbol_exprt> modifies;
+  std::unordered_set<irep_idt> declared;
+
+  for(auto it = loop_head; it != std::next(loop_back_edge); ++it)
+  {
+    if(it->is_assign())
+    {
+      if(!get_modified_symbol(it->get_assign().lhs(), modifies))
+      {
+        not_applicable("write through pointer");
+        return;
+      }
+    }
+    else if(it->is_decl())
+      declared.insert(it->get_decl().get_identifier());
+    else if(it->is_function_call())
+    {
+      not_applicable("function call");
+      return;
+    }
+    else if(it->is_other() || it->is_start_thread())
+    {
+      not_applicable("unsupported instruction");
+      return;
+    }
+    else if(it->is_assert())
+      loop_properties.insert(it->source_location.get_property_id());
+  }
+
+  if(loop_properties.empty())
+    return;
+
+  // Objects declared in the loop are not live when it is entered.
+  std::vector<symbol_exprt> havoc_objects;
+  std::unordered_set<irep_idt> havocked;
+  for(const auto &symbol : modifies)
+  {
+    if(
+      declared.count(symbol.get_identifier()) == 0 &&
+      havocked.insert(symbol.get_identifier()).second)
+    {
+      havoc_objects.push_back(symbol);
+    }
+  }
+
+  step_symex.havoc_on_loop_entry(loop_head, std::move(havoc_objects));
+  step_case_enabled = true;
+}
+
+void k_induction_symex_checkert::unwinding_checked(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+  if(!step_case_enabled)
+    return;
+
+  messaget log(ui_message_handler);
+
+  // The inductive step assumes the assertions before the latest iteration
+  // to hold, which is unjustified once one of them fails.
+  for(const auto &property_pair : properties)
+  {
+    if(property_pair.second.status == property_statust::FAIL)
+    {
+      step_case_enabled = false;
+      return;
+    }
+  }
+
+  // The base case has shown the properties to hold for the first
+  // base_unwind iterations, hence the inductive step may assume up to as
+  // many iterations.
+  const unsigned base_unwind = symex.get_unwind();
+
+  while(assumed_unwind <= base_unwind)
+  {
+    const bool paused =
+      step_symex_started
+        ? step_symex.resume(
+            goto_symext::get_goto_function(goto_model),
+            step_symex_symbol_table)
+        : step_symex.from_entry_point_of(
+            goto_symext::get_goto_function(goto_model),
+            step_symex_symbol_table);
+    step_symex_started = true;
+
+    if(!paused)
+    {
+      // The loop has been left, and the equation now contains the code
+      // following it, which the inductive step does not account for.
+      step_case_enabled = false;
+      return;
+    }
+
+    if(check_step_case())
+    {
+      log.status() << "Inductive step for loop " << symex.incremental_loop_id
+                   << " holds assuming " << assumed_unwind << " iteration"
+                   << (assumed_unwind == 1 ? "" : "s") << messaget::eom;
+
+      for(auto &property_pair : properties)
+      {
+        if(
+          loop_properties.count(property_pair.first) != 0 &&
+          is_property_to_check(property_pair.second.status))
+        {
+          property_pair.second.status = property_statust::PASS;
+          updated_properties.insert(property_pair.first);
+        }
+      }
+
+      step_case_enabled = false;
+      return;
+    }
+
+    assumed_unwind = step_symex.get_unwind();
+  }
+}
+
+bool k_induction_symex_checkert::check_step_case()
+{
+  // The assertions of the earlier iterations and those outside the loop
+  // become assumptions, just as the goto-instrument k-induction turns
+  // assertions into assumptions.
+  std::size_t step_index = 0;
+  std::size_t number_of_assertions = 0;
+
+  for(auto &step : step_equation.SSA_steps)
+  {
+    if(step.is_assert())
+    {
+      if(
+        step_index < assumed_steps ||
+        loop_properties.count(step.get_property_id()) == 0)
+      {
+        step.type = goto_trace_stept::typet::ASSUME;
+      }
+      else
+        ++number_of_assertions;
+    }
+
+    ++step_index;
+  }
+
+  messaget log(ui_message_handler);
+  log.status() << "Checking inductive step for "
+               << step_symex.get_unwind() << " iterations of loop "
+               << symex.incremental_loop_id << messaget::eom;
+
+  decision_proceduret &decision_procedure = step_solver->decision_procedure();
+  step_equation.convert_without_assertions(decision_procedure);
+  assumed_steps = step_equation.SSA_steps.size();
+
+  // The latest iteration does not reach any assertion.
+  if(number_of_assertions == 0)
+    return true;
+
+  stack_decision_proceduret &stack_decision_procedure =
+    step_solver->stack_decision_procedure();
+  stack_decision_procedure.push();
+  step_equation.convert_assertions(decision_procedure);
+  const bool holds =
+    decision_procedure() == decision_proceduret::resultt::D_UNSATISFIABLE;
+  stack_decision_procedure.pop();
+
+  return holds;
+}
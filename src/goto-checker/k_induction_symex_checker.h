@@ -0,0 +1,78 @@
+/*******************************************************************\
+
+Module: Goto Checker using k-Induction
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using incremental k-induction over a single loop
+
+#ifndef CPROVER_GOTO_CHECKER_K_INDUCTION_SYMEX_CHECKER_H
+#define CPROVER_GOTO_CHECKER_K_INDUCTION_SYMEX_CHECKER_H
+
+#include "single_loop_incremental_symex_checker.h"
+
+/// Extends \ref single_loop_incremental_symex_checkert, which acts as the
+/// base case, by the inductive step of k-induction for the loop given by
+/// `--incremental-check`.
+/// The inductive step is a second symbolic execution of the program that
+/// havocs the objects modified by the loop when entering it. It is unwound
+/// incrementally alongside the base case on a solver of its own: the
+/// assertions of the iterations checked so far are turned into assumptions,
+/// and only the assertions of the latest iteration are checked.
+/// Once the base case has shown the properties of the loop to hold for k
+/// iterations and the inductive step shows that k iterations in which they
+/// hold are always followed by one in which they hold, these properties
+/// hold for any number of iterations.
+/// The inductive step is only applicable to loops that are entered at most
+/// once and whose bodies neither call functions nor write through pointers;
+/// other loops are just unwound incrementally.
+class k_induction_symex_checkert : public single_loop_incremental_symex_checkert
+{
+public:
+  k_induction_symex_checkert(
+    const optionst &options,
+    ui_message_handlert &ui_message_handler,
+    abstract_goto_modelt &goto_model);
+
+protected:
+  symbol_tablet step_symex_symbol_table;
+  namespacet step_ns;
+  symex_target_equationt step_equation;
+  guard_managert step_guard_manager;
+  path_fifot step_path_storage; // should go away
+  symex_bmc_incremental_one_loopt step_symex;
+  std::unique_ptr<solver_factoryt::solvert> step_solver;
+
+  /// The inductive step is applicable and has not been decided yet
+  bool step_case_enabled = false;
+  bool step_symex_started = false;
+
+  /// Number of iterations of the loop in the inductive step whose
+  /// assertions are assumed to hold
+  unsigned assumed_unwind = 0;
+
+  /// Number of SSA steps of the inductive step whose assertions are
+  /// assumed to hold
+  std::size_t assumed_steps = 0;
+
+  /// The properties whose assertions are in the body of the loop
+  std::unordered_set<irep_idt> loop_properties;
+
+  /// Check whether the inductive step is applicable to the loop and, if so,
+  /// set up the havocking of the objects that the loop modifies
+  void setup_step_case();
+
+  void unwinding_checked(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties) override;
+
+  /// Pass the steps added to the inductive step since the last call to the
+  /// solver and check the assertions of the latest iteration
+  /// \return true if these assertions cannot fail
+  bool check_step_case();
+};
+
+#endif // CPROVER_GOTO_CHECKER_K_INDUCTION_SYMEX_CHECKER_H
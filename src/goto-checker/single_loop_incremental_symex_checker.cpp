@@ -0,0 +1,260 @@
+/*******************************************************************\
+
+Module: Goto Checker using Incremental Loop Unwinding
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using multi-path symbolic execution that incrementally
+/// unwinds a single loop
+
+#include "single_loop_incremental_symex_checker.h"
+
+#include <util/exception_utils.h>
+
+#include <goto-symex/slice.h>
+
+#include "bmc_util.h"
+#include "counterexample_beautification.h"
+
+single_loop_incremental_symex_checkert::single_loop_incremental_symex_checkert(
+  const optionst &options,
+  ui_message_handlert &ui_message_handler,
+  abstract_goto_modelt &goto_model)
+  : incremental_goto_checkert(options, ui_message_handler),
+    goto_model(goto_model),
+    ns(goto_model.get_symbol_table(), symex_symbol_table),
+    equation(ui_message_handler),
+    symex(
+      ui_message_handler,
+      goto_model.get_symbol_table(),
+      equation,
+      options,
+      path_storage,
+      guard_manager),
+    property_decider(options, ui_message_handler, equation, ns)
+{
+  setup_symex(symex, ns, options, ui_message_handler);
+}
+
+incremental_goto_checkert::resultt single_loop_incremental_symex_checkert::
+operator()(propertiest &properties)
+{
+  resultt result(resultt::progresst::DONE);
+  std::chrono::duration<double> solver_runtime(0);
+
+  if(!symex_started)
+  {
+    full_equation_generated = !symex.from_entry_point_of(
+      goto_symext::get_goto_function(goto_model), symex_symbol_table);
+    symex_started = true;
+
+    update_properties_status_from_symex_target_equation(
+      properties, result.updated_properties, equation);
+  }
+
+  while(true)
+  {
+    // If the assertions have already been converted then we are looking for
+    // further failing properties at the current unwinding.
+    if(!assertions_converted)
+    {
+      if(!has_properties_to_check(properties))
+        return result;
+
+      solver_runtime = convert_equation(properties);
+    }
+
+    // A property that holds for the current unwinding may still fail for a
+    // later one, hence properties are only set to PASS once the full
+    // equation has been checked.
+    run_property_decider(
+      result,
+      properties,
+      property_decider,
+      ui_message_handler,
+      solver_runtime,
+      full_equation_generated);
+    solver_runtime = std::chrono::duration<double>(0);
+
+    if(result.progress == resultt::progresst::FOUND_FAIL)
+      return result;
+
+    // The assertions of this unwinding have been dealt with.
+    property_decider.get_stack_decision_procedure().pop();
+    assertions_converted = false;
+
+    if(full_equation_generated)
+    {
+      // Properties that have not been reached hold as well.
+      update_status_of_unknown_properties(
+        properties, result.updated_properties);
+      update_status_of_not_checked_properties(
+        properties, result.updated_properties);
+      return result;
+    }
+
+    unwinding_checked(properties, result.updated_properties);
+    if(!has_properties_to_check(properties))
+      return result;
+
+    check_loop_guard();
+
+    // Steps that are irrelevant for the current properties may be needed for
+    // those of the following unwindings. Steps that have been sliced away
+    // have not been converted yet, hence this does not duplicate anything.
+    // Assertions converted for earlier unwindings are ignored again by the
+    // next conversion, so they do not return as goals.
+    revert_slice(equation);
+
+    full_equation_generated = !symex.resume(
+      goto_symext::get_goto_function(goto_model), symex_symbol_table);
+
+    update_properties_status_from_symex_target_equation(
+      properties, result.updated_properties, equation);
+  }
+}
+
+std::chrono::duration<double>
+single_loop_incremental_symex_checkert::convert_equation(
+  propertiest &properties)
+{
+  auto solver_start = std::chrono::steady_clock::now();
+
+  // The partial order constraints of threads are built over the whole
+  // equation, which we do not have until symex has completed.
+  if(equation.has_threads())
+  {
+    throw unsupported_operation_exceptiont(
+      "--incremental-check does not support multi-threaded programs");
+  }
+
+  messaget log(ui_message_handler);
+  log.statistics() << "size of program expression: "
+                   << equation.SSA_steps.size() << " steps" << messaget::eom;
+
+  slice(symex, equation, ns, options, ui_message_handler);
+
+  decision_proceduret &decision_procedure =
+    property_decider.get_decision_procedure();
+
+  log.status() << "Passing problem to "
+               << decision_procedure.decision_procedure_text() << " for "
+               << (full_equation_generated
+                     ? "the full program"
+                     : std::to_string(symex.get_unwind()) +
+                         " iterations of loop " +
+                         id2string(symex.incremental_loop_id))
+               << messaget::eom;
+
+  // Everything but the assertions remains valid for later unwindings and
+  // is only converted once.
+  equation.convert_without_assertions(decision_procedure);
+
+  // The assertions are converted in a context of their own, which is popped
+  // once this unwinding has been checked.
+  property_decider.get_stack_decision_procedure().push();
+  equation.convert_assertions(decision_procedure);
+  property_decider.update_properties_goals_from_symex_target_equation(
+    properties);
+  property_decider.convert_goals();
+  assertions_converted = true;
+
+  auto solver_stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(solver_stop - solver_start);
+}
+
+void single_loop_incremental_symex_checkert::check_loop_guard()
+{
+  decision_proceduret &decision_procedure =
+    property_decider.get_decision_procedure();
+
+  const exprt guard = decision_procedure.handle(symex.get_loop_guard());
+
+  bool may_continue;
+  if(guard.is_constant())
+  {
+    may_continue = guard.is_true();
+  }
+  else
+  {
+    stack_decision_proceduret &stack_decision_procedure =
+      property_decider.get_stack_decision_procedure();
+    stack_decision_procedure.push({guard});
+    may_continue =
+      decision_procedure() != decision_proceduret::resultt::D_UNSATISFIABLE;
+    stack_decision_procedure.pop();
+  }
+
+  if(!may_continue)
+  {
+    messaget log(ui_message_handler);
+    log.status() << "Unwinding assertion of loop " << symex.incremental_loop_id
+                 << " proved for unwinding " << symex.get_unwind()
+                 << messaget::eom;
+
+    symex.stop_unwinding();
+  }
+}
+
+goto_tracet single_loop_incremental_symex_checkert::build_full_trace() const
+{
+  goto_tracet goto_trace;
+  build_goto_trace(
+    equation,
+    equation.SSA_steps.end(),
+    property_decider.get_decision_procedure(),
+    ns,
+    goto_trace);
+
+  return goto_trace;
+}
+
+goto_tracet single_loop_incremental_symex_checkert::build_shortest_trace() const
+{
+  if(options.get_bool_option("beautify"))
+  {
+    // NOLINTNEXTLINE(whitespace/braces)
+    counterexample_beautificationt{ui_message_handler}(
+      dynamic_cast<boolbvt &>(property_decider.get_stack_decision_procedure()),
+      equation);
+  }
+
+  goto_tracet goto_trace;
+  build_goto_trace(
+    equation, property_decider.get_decision_procedure(), ns, goto_trace);
+
+  return goto_trace;
+}
+
+goto_tracet single_loop_incremental_symex_checkert::build_trace(
+  const irep_idt &property_id) const
+{
+  goto_tracet goto_trace;
+  build_goto_trace(
+    equation,
+    ssa_step_matches_failing_property(property_id),
+    property_decider.get_decision_procedure(),
+    ns,
+    goto_trace);
+
+  return goto_trace;
+}
+
+const namespacet &single_loop_incremental_symex_checkert::get_namespace() const
+{
+  return ns;
+}
+
+void single_loop_incremental_symex_checkert::output_proof()
+{
+  output_graphml(equation, ns, options);
+}
+
+void single_loop_incremental_symex_checkert::output_error_witness(
+  const goto_tracet &error_trace)
+{
+  output_graphml(error_trace, ns, options);
+}
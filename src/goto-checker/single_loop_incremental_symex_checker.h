@@ -0,0 +1,94 @@
+/*******************************************************************\
+
+Module: Goto Checker using Incremental Loop Unwinding
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using multi-path symbolic execution that incrementally
+/// unwinds a single loop
+
+#ifndef CPROVER_GOTO_CHECKER_SINGLE_LOOP_INCREMENTAL_SYMEX_CHECKER_H
+#define CPROVER_GOTO_CHECKER_SINGLE_LOOP_INCREMENTAL_SYMEX_CHECKER_H
+
+#include <chrono>
+
+#include "goto_symex_property_decider.h"
+#include "goto_trace_provider.h"
+#include "incremental_goto_checker.h"
+#include "symex_bmc_incremental_one_loop.h"
+#include "witness_provider.h"
+
+/// Performs a multi-path symbolic execution that unwinds the loop given by
+/// `--incremental-check` one iteration at a time, starting from
+/// `--unwind-min` up to `--unwind-max` iterations.
+/// After each iteration, the properties encountered so far are checked.
+/// Symbolic execution is then resumed from its saved state, and only the
+/// part of the equation that has been added since is passed to the solver,
+/// which is kept alive to benefit from what it has learnt.
+/// If the solver shows that the loop cannot execute a further iteration,
+/// the unwinding assertion of the loop holds and unwinding stops early.
+class single_loop_incremental_symex_checkert : public incremental_goto_checkert,
+                                               public goto_trace_providert,
+                                               public witness_providert
+{
+public:
+  single_loop_incremental_symex_checkert(
+    const optionst &options,
+    ui_message_handlert &ui_message_handler,
+    abstract_goto_modelt &goto_model);
+
+  /// \copydoc incremental_goto_checkert::operator()(propertiest &properties)
+  ///
+  /// Note: Repeated invocations of this operator with properties P_1, P_2, ...
+  ///   must satisfy the condition 'P_i contains P_i+1'.
+  resultt operator()(propertiest &) override;
+
+  goto_tracet build_full_trace() const override;
+  goto_tracet build_shortest_trace() const override;
+  goto_tracet build_trace(const irep_idt &) const override;
+  const namespacet &get_namespace() const override;
+
+  void output_error_witness(const goto_tracet &) override;
+  void output_proof() override;
+
+protected:
+  abstract_goto_modelt &goto_model;
+  symbol_tablet symex_symbol_table;
+  namespacet ns;
+  symex_target_equationt equation;
+  guard_managert guard_manager;
+  path_fifot path_storage; // should go away
+  symex_bmc_incremental_one_loopt symex;
+  goto_symex_property_decidert property_decider;
+
+  bool symex_started = false;
+  bool full_equation_generated = false;
+
+  /// The assertions of the current equation have been passed to the
+  /// solver in a context of their own, which needs to be popped before
+  /// the next unwinding
+  bool assertions_converted = false;
+
+  /// Slice the equation and pass the steps added since the last call
+  /// together with the current assertions to the solver
+  /// \return the time taken
+  std::chrono::duration<double> convert_equation(propertiest &properties);
+
+  /// Called once the properties have been checked for the current unwinding
+  /// without finding a failure, before unwinding continues. Derived checkers
+  /// may decide further properties here.
+  virtual void unwinding_checked(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties)
+  {
+  }
+
+  /// Check whether the paused state can execute a further iteration of the
+  /// loop, and stop unwinding it if it cannot
+  void check_loop_guard();
+};
+
+#endif // CPROVER_GOTO_CHECKER_SINGLE_LOOP_INCREMENTAL_SYMEX_CHECKER_H
@@ -0,0 +1,147 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking for ANSI-C
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Incremental Bounded Model Checking for ANSI-C
+
+#include "symex_bmc_incremental_one_loop.h"
+
+#include <util/invariant.h>
+#include <util/options.h>
+
+#include <limits>
+
+symex_bmc_incremental_one_loopt::symex_bmc_incremental_one_loopt(
+  message_handlert &mh,
+  const symbol_tablet &outer_symbol_table,
+  symex_target_equationt &_target,
+  const optionst &options,
+  path_storaget &path_storage,
+  guard_managert &guard_manager)
+  : symex_bmct(
+      mh,
+      outer_symbol_table,
+      _target,
+      options,
+      path_storage,
+      guard_manager),
+    incremental_loop_id(options.get_option("incremental-check")),
+    unwind_min(options.get_unsigned_int_option("unwind-min")),
+    unwind_max(
+      options.is_set("unwind-max")
+        ? options.get_unsigned_int_option("unwind-max")
+        : std::numeric_limits<unsigned>::max())
+{
+}
+
+bool symex_bmc_incremental_one_loopt::from_entry_point_of(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table)
+{
+  state = initialize_entry_point_state(get_goto_function);
+
+  return resume(get_goto_function, new_symbol_table);
+}
+
+bool symex_bmc_incremental_one_loopt::resume(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table)
+{
+  PRECONDITION(state);
+
+  should_pause_symex = false;
+  symex_with_state(*state, get_goto_function, new_symbol_table);
+
+  if(!should_pause_symex)
+  {
+    state.reset();
+    return false;
+  }
+
+  // symex_with_state only hands out the symbols once it has completed,
+  // but the equation is to be converted while symex is paused
+  new_symbol_table = state->symbol_table;
+  return true;
+}
+
+exprt symex_bmc_incremental_one_loopt::get_loop_guard() const
+{
+  PRECONDITION(state);
+  return state->guard.as_expr();
+}
+
+void symex_bmc_incremental_one_loopt::stop_unwinding()
+{
+  PRECONDITION(state);
+
+  // symex skips the instructions up to the next merge with a feasible state
+  state->guard.add(false_exprt());
+}
+
+void symex_bmc_incremental_one_loopt::havoc_on_loop_entry(
+  goto_programt::const_targett loop_head,
+  std::vector<symbol_exprt> objects)
+{
+  havoc_loop_head = loop_head;
+  havoc_objects = std::move(objects);
+}
+
+void symex_bmc_incremental_one_loopt::symex_step(
+  const get_goto_functiont &get_goto_function,
+  statet &state)
+{
+  if(havoc_loop_head.has_value() && state.source.pc == *havoc_loop_head)
+  {
+    // All paths entering the loop need to be havocked, hence merge them
+    // first. Merging again in symex_bmct::symex_step then has no effect.
+    merge_gotos(state);
+
+    if(!state.guard.is_false())
+    {
+      for(const auto &object : havoc_objects)
+        havoc_rec(state, guardt(true_exprt(), guard_manager), object);
+    }
+
+    // Later arrivals at the loop head are further iterations.
+    havoc_loop_head.reset();
+  }
+
+  symex_bmct::symex_step(get_goto_function, state);
+}
+
+bool symex_bmc_incremental_one_loopt::should_stop_unwind(
+  const symex_targett::sourcet &source,
+  const call_stackt &context,
+  unsigned unwind)
+{
+  const irep_idt id = goto_programt::loop_id(source.function_id, *source.pc);
+
+  if(id != incremental_loop_id)
+    return symex_bmct::should_stop_unwind(source, context, unwind);
+
+  const bool abort = unwind >= unwind_max;
+
+  log.statistics() << (abort ? "Not unwinding" : "Unwinding") << " loop " << id
+                   << " iteration " << unwind;
+
+  if(unwind_max != std::numeric_limits<unsigned>::max())
+    log.statistics() << " (" << unwind_max << " max)";
+
+  log.statistics() << " " << source.pc->source_location << " thread "
+                   << source.thread_nr << log.eom;
+
+  // Pause once this step has completed, i.e., before executing the next
+  // iteration, so that the properties can be checked first.
+  if(!abort && unwind >= unwind_min)
+  {
+    should_pause_symex = true;
+    paused_unwind = unwind;
+  }
+
+  return abort;
+}
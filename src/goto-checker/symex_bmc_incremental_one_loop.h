@@ -0,0 +1,105 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking for ANSI-C
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Incremental Bounded Model Checking for ANSI-C
+
+#ifndef CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_ONE_LOOP_H
+#define CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_ONE_LOOP_H
+
+#include <util/optional.h>
+#include <util/std_expr.h>
+
+#include "symex_bmc.h"
+
+/// Symbolic execution that pauses whenever it is about to execute a further
+/// iteration of one given loop (`--incremental-check L`), so that the
+/// properties can be checked for the unwindings so far before symbolic
+/// execution is resumed from the saved state.
+class symex_bmc_incremental_one_loopt : public symex_bmct
+{
+public:
+  symex_bmc_incremental_one_loopt(
+    message_handlert &mh,
+    const symbol_tablet &outer_symbol_table,
+    symex_target_equationt &_target,
+    const optionst &options,
+    path_storaget &path_storage,
+    guard_managert &guard_manager);
+
+  /// Start symbolic execution from the entry point
+  /// \param get_goto_function: The delegate to retrieve function bodies
+  /// \param new_symbol_table: A symbol table to store the symbols added during
+  ///   symbolic execution, also when it pauses
+  /// \return true if symbolic execution has been paused and can be resumed
+  bool from_entry_point_of(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table);
+
+  /// Resume symbolic execution from the state in which it has been paused
+  /// \param get_goto_function: The delegate to retrieve function bodies
+  /// \param new_symbol_table: A symbol table to store the symbols added during
+  ///   symbolic execution, also when it pauses again
+  /// \return true if symbolic execution has been paused again
+  bool resume(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table);
+
+  /// The guard under which the paused state executes the next iteration
+  /// of the loop
+  exprt get_loop_guard() const;
+
+  /// Give up the next iteration of the loop in the paused state, because
+  /// its guard has been shown to be infeasible. The unwinding assertion of
+  /// the loop then holds and there is no point in unwinding it any further.
+  void stop_unwinding();
+
+  /// Havoc the given objects when symbolic execution first reaches the head
+  /// of the loop, such that the loop starts from an arbitrary state as
+  /// required for the inductive step of k-induction
+  /// \param loop_head: The first instruction of the loop
+  /// \param objects: The objects that the loop may modify
+  void havoc_on_loop_entry(
+    goto_programt::const_targett loop_head,
+    std::vector<symbol_exprt> objects);
+
+  /// Number of iterations of the loop executed by the paused state
+  unsigned get_unwind() const
+  {
+    return paused_unwind;
+  }
+
+  /// Identifier of the loop that is unwound incrementally
+  const irep_idt incremental_loop_id;
+
+protected:
+  /// Unwinding from which on the properties are checked
+  const unsigned unwind_min;
+
+  /// Unwinding at which the loop is no longer unwound
+  const unsigned unwind_max;
+
+  unsigned paused_unwind = 0;
+
+  /// The state in which symbolic execution has been paused
+  std::unique_ptr<statet> state;
+
+  /// Head of the loop at which \ref havoc_objects are havocked
+  optionalt<goto_programt::const_targett> havoc_loop_head;
+  std::vector<symbol_exprt> havoc_objects;
+
+  void symex_step(const get_goto_functiont &get_goto_function, statet &state)
+    override;
+
+  bool should_stop_unwind(
+    const symex_targett::sourcet &source,
+    const call_stackt &context,
+    unsigned unwind) override;
+};
+
+#endif // CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_ONE_LOOP_H
@@ -0,0 +1,202 @@
+/*******************************************************************\
+
+Module: Cache of Analyses of a Goto Model
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of analyses that are shared between the passes of goto-instrument
+
+#include "analysis_manager.h"
+
+#include <util/irep_hash.h>
+#include <util/make_unique.h>
+
+analysis_managert::fingerprintt
+analysis_managert::control_flow_fingerprint(const goto_programt &body) const
+{
+  // The location numbers may be out of date, hence the positions of the
+  // targets are worked out here.
+  std::unordered_map<const goto_programt::instructiont *, std::size_t>
+    positions;
+  for(const auto &instruction : body.instructions)
+    positions.emplace(&instruction, positions.size());
+
+  fingerprintt fingerprint = body.instructions.size();
+
+  for(const auto &instruction : body.instructions)
+  {
+    fingerprint = hash_combine(fingerprint, instruction.type);
+    // the guard decides whether a goto has a fall-through successor
+    fingerprint = hash_combine(fingerprint, instruction.guard.hash());
+
+    for(const auto &target : instruction.targets)
+      fingerprint = hash_combine(fingerprint, positions.at(&*target));
+  }
+
+  return fingerprint;
+}
+
+analysis_managert::fingerprintt
+analysis_managert::full_fingerprint(const goto_programt &body) const
+{
+  fingerprintt fingerprint = control_flow_fingerprint(body);
+
+  for(const auto &instruction : body.instructions)
+    fingerprint = hash_combine(fingerprint, instruction.code.hash());
+
+  return fingerprint;
+}
+
+analysis_managert::fingerprintt
+analysis_managert::full_fingerprint(const goto_functionst &goto_functions) const
+{
+  fingerprintt fingerprint = goto_functions.function_map.size();
+
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    fingerprint = hash_combine(fingerprint, gf_entry.first.hash());
+    fingerprint =
+      hash_combine(fingerprint, full_fingerprint(gf_entry.second.body));
+  }
+
+  return fingerprint;
+}
+
+analysis_managert::instructionst
+analysis_managert::instructions(const goto_programt &body)
+{
+  instructionst result;
+  result.reserve(body.instructions.size());
+
+  for(const auto &instruction : body.instructions)
+    result.push_back(&instruction);
+
+  return result;
+}
+
+analysis_managert::instructionst
+analysis_managert::instructions(const goto_functionst &goto_functions)
+{
+  instructionst result;
+
+  for(const auto &gf_entry : goto_functions.function_map)
+  {
+    for(const auto &instruction : gf_entry.second.body.instructions)
+      result.push_back(&instruction);
+  }
+
+  return result;
+}
+
+template <typename T>
+bool analysis_managert::is_valid(
+  analysist analysis,
+  cachedt<T> &cached,
+  fingerprintt fingerprint,
+  instructionst instructions)
+{
+  statisticst &analysis_statistics = statistics[analysis];
+
+  if(
+    cached.result && cached.fingerprint == fingerprint &&
+    cached.instructions == instructions)
+  {
+    ++analysis_statistics.hits;
+    return true;
+  }
+
+  if(cached.result)
+  {
+    ++analysis_statistics.invalidations;
+    cached.result.reset();
+  }
+
+  ++analysis_statistics.misses;
+  cached.fingerprint = fingerprint;
+  cached.instructions = std::move(instructions);
+  return false;
+}
+
+const natural_loops_mutablet &
+analysis_managert::natural_loops(const irep_idt &function_id)
+{
+  goto_programt &body =
+    goto_model.goto_functions.function_map.at(function_id).body;
+  cachedt<natural_loops_mutablet> &cached = natural_loops_cache[function_id];
+
+  if(!is_valid(
+       analysist::NATURAL_LOOPS,
+       cached,
+       control_flow_fingerprint(body),
+       instructions(body)))
+  {
+    cached.result = util_make_unique<natural_loops_mutablet>(body);
+  }
+
+  return *cached.result;
+}
+
+const call_grapht &analysis_managert::call_graph()
+{
+  // The call graph does not record call sites, so it does not refer to any
+  // instructions.
+  if(!is_valid(
+       analysist::CALL_GRAPH,
+       call_graph_cache,
+       full_fingerprint(goto_model.goto_functions),
+       {}))
+  {
+    call_graph_cache.result = util_make_unique<call_grapht>(goto_model);
+  }
+
+  return *call_graph_cache.result;
+}
+
+value_set_analysist &analysis_managert::value_sets()
+{
+  if(!is_valid(
+       analysist::VALUE_SETS,
+       value_sets_cache,
+       full_fingerprint(goto_model.goto_functions),
+       instructions(goto_model.goto_functions)))
+  {
+    value_sets_cache.result = util_make_unique<value_set_analysist>(ns);
+    (*value_sets_cache.result)(goto_model.goto_functions);
+  }
+
+  return *value_sets_cache.result;
+}
+
+void analysis_managert::clear()
+{
+  natural_loops_cache.clear();
+  call_graph_cache.result.reset();
+  value_sets_cache.result.reset();
+}
+
+void analysis_managert::output_statistics() const
+{
+  for(const auto &entry : statistics)
+  {
+    switch(entry.first)
+    {
+    case analysist::NATURAL_LOOPS:
+      log.statistics() << "Natural loops";
+      break;
+    case analysist::CALL_GRAPH:
+      log.statistics() << "Call graph";
+      break;
+    case analysist::VALUE_SETS:
+      log.statistics() << "Value sets";
+      break;
+    }
+
+    log.statistics() << ": " << entry.second.misses << " computed, "
+                     << entry.second.hits << " reused, "
+                     << entry.second.invalidations << " invalidated"
+                     << messaget::eom;
+  }
+}
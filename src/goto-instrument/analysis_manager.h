@@ -0,0 +1,128 @@
+/*******************************************************************\
+
+Module: Cache of Analyses of a Goto Model
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Cache of analyses that are shared between the passes of goto-instrument
+
+#ifndef CPROVER_GOTO_INSTRUMENT_ANALYSIS_MANAGER_H
+#define CPROVER_GOTO_INSTRUMENT_ANALYSIS_MANAGER_H
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <util/message.h>
+#include <util/namespace.h>
+
+#include <analyses/call_graph.h>
+#include <analyses/natural_loops.h>
+
+#include <pointer-analysis/value_set_analysis.h>
+
+/// Computes analyses of a goto model on demand and keeps them for later
+/// passes.
+///
+/// Each cached result records a fingerprint of what it was computed from:
+/// per-function analyses that of the body of their function, and
+/// whole-program analyses that of all bodies. A cached result is only
+/// handed out again if the fingerprint is unchanged, so results are
+/// recomputed for exactly those functions that a pass has modified.
+/// The fingerprint of the control flow of a body covers the types and
+/// guards of its instructions and the positions of their targets; the full
+/// fingerprint also covers their code.
+///
+/// Results refer to instructions via iterators, hence a result is also
+/// recomputed if any of the instructions it was computed from is no longer
+/// at the same address. An instruction that has been replaced by one at
+/// the same address is harmless, as the fingerprint then shows whether the
+/// two differ.
+class analysis_managert
+{
+public:
+  enum class analysist
+  {
+    NATURAL_LOOPS,
+    CALL_GRAPH,
+    VALUE_SETS
+  };
+
+  analysis_managert(
+    goto_modelt &_goto_model,
+    message_handlert &message_handler)
+    : goto_model(_goto_model),
+      ns(_goto_model.symbol_table),
+      log(message_handler)
+  {
+  }
+
+  /// The natural loops of the function \p function_id, which also provide
+  /// its dominators
+  const natural_loops_mutablet &natural_loops(const irep_idt &function_id);
+
+  const call_grapht &call_graph();
+
+  /// The value sets are computed flow-sensitively for the whole program.
+  /// Clients may add to them, as remove_pointers does, hence they are not
+  /// const.
+  value_set_analysist &value_sets();
+
+  /// Drop all cached results
+  void clear();
+
+  /// Output the number of results computed and reused per analysis
+  void output_statistics() const;
+
+protected:
+  goto_modelt &goto_model;
+  const namespacet ns;
+  mutable messaget log;
+
+  typedef std::size_t fingerprintt;
+  typedef std::vector<const goto_programt::instructiont *> instructionst;
+
+  fingerprintt control_flow_fingerprint(const goto_programt &) const;
+  fingerprintt full_fingerprint(const goto_programt &) const;
+  fingerprintt full_fingerprint(const goto_functionst &) const;
+
+  static instructionst instructions(const goto_programt &);
+  static instructionst instructions(const goto_functionst &);
+
+  struct statisticst
+  {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t invalidations = 0;
+  };
+
+  std::map<analysist, statisticst> statistics;
+
+  template <typename T>
+  struct cachedt
+  {
+    fingerprintt fingerprint = 0;
+    instructionst instructions;
+    std::unique_ptr<T> result;
+  };
+
+  std::unordered_map<irep_idt, cachedt<natural_loops_mutablet>>
+    natural_loops_cache;
+  cachedt<call_grapht> call_graph_cache;
+  cachedt<value_set_analysist> value_sets_cache;
+
+  /// \return true if \p cached holds a result computed from \p fingerprint
+  ///   and \p instructions, and otherwise drops the result
+  template <typename T>
+  bool is_valid(
+    analysist analysis,
+    cachedt<T> &cached,
+    fingerprintt fingerprint,
+    instructionst instructions);
+};
+
+#endif // CPROVER_GOTO_INSTRUMENT_ANALYSIS_MANAGER_H
@@ -19,14 +19,18 @@ Author: Daniel Kroening, kroening@kroening.com
 
 void full_slicert::add_dependencies(
   const cfgt::nodet &node,
+  dep_grapht::node_indext dep_node,
   queuet &queue,
-  const dependence_grapht &dep_graph,
+  const dep_grapht &dep_graph,
   const dep_node_to_cfgt &dep_node_to_cfg)
 {
-  const dependence_grapht::nodet &d_node=
-    dep_graph[dep_graph[node.PC].get_node_id()];
+  // instructions without a node have no dependencies
+  if(dep_node>=dep_graph.size())
+    return;
+
+  const dep_grapht::nodet &d_node=dep_graph[dep_node];
 
-  for(dependence_grapht::edgest::const_iterator
+  for(dep_grapht::edgest::const_iterator
       it=d_node.in.begin();
       it!=d_node.in.end();
       ++it)
@@ -217,17 +221,21 @@ void full_slicert::fixedpoint(
   queuet &queue,
   jumpst &jumps,
   decl_deadt &decl_dead,
-  const dependence_grapht &dep_graph)
+  const dep_grapht &dep_graph,
+  const dependence_grapht::post_dominators_mapt &post_dominators)
 {
-  std::vector<cfgt::entryt> dep_node_to_cfg;
+  dep_node_to_cfgt dep_node_to_cfg;
   dep_node_to_cfg.reserve(dep_graph.size());
-  for(dependence_grapht::node_indext i=0; i<dep_graph.size(); ++i)
+  std::vector<dep_grapht::node_indext> cfg_to_dep_node(
+    cfg.size(), dep_graph.size());
+  for(dep_grapht::node_indext i=0; i<dep_graph.size(); ++i)
   {
     cfgt::entry_mapt::const_iterator entry=
       cfg.entry_map.find(dep_graph[i].PC);
     assert(entry!=cfg.entry_map.end());
 
     dep_node_to_cfg.push_back(entry->second);
+    cfg_to_dep_node[entry->second]=i;
   }
 
   // process queue until empty
@@ -247,7 +255,8 @@ void full_slicert::fixedpoint(
       node.node_required=true;
 
       // add data and control dependencies of node
-      add_dependencies(node, queue, dep_graph, dep_node_to_cfg);
+      add_dependencies(
+        node, cfg_to_dep_node[e], queue, dep_graph, dep_node_to_cfg);
 
       // retain all calls of the containing function
       add_function_calls(node, queue, goto_functions);
@@ -257,7 +266,7 @@ void full_slicert::fixedpoint(
     }
 
     // add any required jumps
-    add_jumps(queue, jumps, dep_graph.cfg_post_dominators());
+    add_jumps(queue, jumps, post_dominators);
   }
 }
 
@@ -326,12 +335,46 @@ void full_slicert::operator()(
     }
   }
 
-  // compute program dependence graph (and post-dominators)
-  dependence_grapht dep_graph(ns);
-  dep_graph(goto_functions, ns);
+  // compute program dependence graph (and post-dominators): the sparse
+  // graph tracks neither the interference between threads nor the return
+  // values that remove_returns has not turned into assignments
+  bool sparse=true;
+  forall_goto_functions(f_it, goto_functions)
+  {
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      if(i_it->is_start_thread() || i_it->is_return())
+        sparse=false;
+    }
+  }
 
   // compute the fixedpoint
-  fixedpoint(goto_functions, queue, jumps, decl_dead, dep_graph);
+  if(sparse)
+  {
+    sparse_dependence_grapht dep_graph(ns);
+    dep_graph(goto_functions);
+
+    fixedpoint(
+      goto_functions,
+      queue,
+      jumps,
+      decl_dead,
+      dep_graph,
+      dep_graph.cfg_post_dominators());
+  }
+  else
+  {
+    dependence_grapht dep_graph(ns);
+    dep_graph(goto_functions, ns);
+
+    fixedpoint(
+      goto_functions,
+      queue,
+      jumps,
+      decl_dead,
+      dep_graph,
+      dep_graph.cfg_post_dominators());
+  }
 
   // now replace those instructions that are not needed
   // by skips
@@ -20,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-programs/cfg.h>
 
 #include <analyses/dependence_graph.h>
+#include <analyses/sparse_dependence_graph.h>
 
 #include "full_slicer.h"
 
@@ -60,6 +61,9 @@ protected:
   typedef cfg_baset<cfg_nodet> cfgt;
   cfgt cfg;
 
+  /// The program dependence graph, as computed by \ref dependence_grapht or
+  /// \ref sparse_dependence_grapht
+  typedef grapht<dep_nodet> dep_grapht;
   typedef std::vector<cfgt::entryt> dep_node_to_cfgt;
   typedef std::stack<cfgt::entryt> queuet;
   typedef std::list<cfgt::entryt> jumpst;
@@ -70,12 +74,14 @@ protected:
     queuet &queue,
     jumpst &jumps,
     decl_deadt &decl_dead,
-    const dependence_grapht &dep_graph);
+    const dep_grapht &dep_graph,
+    const dependence_grapht::post_dominators_mapt &post_dominators);
 
   void add_dependencies(
     const cfgt::nodet &node,
+    dep_grapht::node_indext dep_node,
     queuet &queue,
-    const dependence_grapht &dep_graph,
+    const dep_grapht &dep_graph,
     const dep_node_to_cfgt &dep_node_to_cfg);
 
   void add_function_calls(
@@ -724,7 +724,7 @@ int goto_instrument_parse_optionst::doit()
     if(cmdline.isset("call-graph"))
     {
       do_indirect_call_and_rtti_removal();
-      call_grapht call_graph(goto_model);
+      const call_grapht &call_graph = analysis_manager.call_graph();
 
       if(cmdline.isset("xml"))
         call_graph.output_xml(std::cout);
@@ -853,7 +853,30 @@ int goto_instrument_parse_optionst::doit()
     }
 
     // write new binary?
-    if(cmdline.args.size()==2)
+    if(cmdline.args.size()==2 && cmdline.isset("delta-base"))
+    {
+      const std::string base_file_name = cmdline.get_value("delta-base");
+      auto base = read_goto_binary(base_file_name, ui_message_handler);
+      if(!base.has_value())
+        return CPROVER_EXIT_INCORRECT_TASK;
+
+      log.status() << "Writing GOTO program to '" << cmdline.args[1]
+                   << "' as delta to '" << base_file_name << "'"
+                   << messaget::eom;
+
+      if(write_goto_binary_delta(
+           cmdline.args[1],
+           base_file_name,
+           *base,
+           goto_model,
+           ui_message_handler))
+      {
+        return CPROVER_EXIT_CONVERSION_FAILED;
+      }
+      else
+        return CPROVER_EXIT_SUCCESS;
+    }
+    else if(cmdline.args.size()==2)
     {
       log.status() << "Writing GOTO program to '" << cmdline.args[1] << "'"
                    << messaget::eom;
@@ -1180,6 +1203,40 @@ void goto_instrument_parse_optionst::instrument_goto_program()
     goto_model.goto_functions.compute_loop_numbers();
   }
 
+  if(cmdline.isset("inline-budget"))
+  {
+    do_indirect_call_and_rtti_removal();
+
+    inline_cost_modelt cost_model;
+    cost_model.size_budget =
+      safe_string2size_t(cmdline.get_value("inline-budget"));
+
+    if(cmdline.isset("inline-loop-factor"))
+    {
+      cost_model.loop_factor =
+        safe_string2size_t(cmdline.get_value("inline-loop-factor"));
+    }
+
+    if(cmdline.isset("inline-profile"))
+    {
+      const std::string profile = cmdline.get_value("inline-profile");
+      std::ifstream in(profile);
+      if(!in)
+      {
+        throw invalid_command_line_argument_exceptiont(
+          "failed to open profile '" + profile + "'", "--inline-profile");
+      }
+
+      parse_symex_call_counts(in, cost_model.call_counts);
+    }
+
+    log.status() << "Cost-model inlining" << messaget::eom;
+    goto_cost_model_inline(goto_model, ui_message_handler, cost_model, true);
+
+    goto_model.goto_functions.update();
+    goto_model.goto_functions.compute_loop_numbers();
+  }
+
   if(cmdline.isset("remove-calls-no-body"))
   {
     log.status() << "Removing calls to functions without a body"
@@ -1287,8 +1344,7 @@ void goto_instrument_parse_optionst::instrument_goto_program()
     do_indirect_call_and_rtti_removal();
 
     log.status() << "Pointer Analysis" << messaget::eom;
-    value_set_analysist value_set_analysis(ns);
-    value_set_analysis(goto_model.goto_functions);
+    value_set_analysist &value_set_analysis = analysis_manager.value_sets();
 
     if(cmdline.isset("remove-pointers"))
     {
@@ -1330,6 +1386,9 @@ void goto_instrument_parse_optionst::instrument_goto_program()
       const unsigned max_po_trans=
         cmdline.isset("max-po-trans")?
         unsafe_string2unsigned(cmdline.get_value("max-po-trans")):0;
+      const unsigned max_cycle_length=
+        cmdline.isset("max-cycle-length")?
+        unsafe_string2unsigned(cmdline.get_value("max-cycle-length")):0;
 
       if(mm=="tso")
       {
@@ -1381,6 +1440,7 @@ void goto_instrument_parse_optionst::instrument_goto_program()
           loops,
           max_var,
           max_po_trans,
+          max_cycle_length,
           !cmdline.isset("no-po-rendering"),
           cmdline.isset("render-cluster-file"),
           cmdline.isset("render-cluster-function"),
@@ -1423,7 +1483,7 @@ void goto_instrument_parse_optionst::instrument_goto_program()
   if(cmdline.isset("havoc-loops"))
   {
     log.status() << "Havocking loops" << messaget::eom;
-    havoc_loops(goto_model);
+    havoc_loops(goto_model, analysis_manager);
   }
 
   if(cmdline.isset("k-induction"))
@@ -1444,7 +1504,7 @@ void goto_instrument_parse_optionst::instrument_goto_program()
     log.status() << "Instrumenting k-induction for k=" << k << ", "
                  << (base_case ? "base case" : "step case") << messaget::eom;
 
-    k_induction(goto_model, base_case, step_case, k);
+    k_induction(goto_model, analysis_manager, base_case, step_case, k);
   }
 
   if(cmdline.isset("function-enter"))
@@ -1581,6 +1641,8 @@ void goto_instrument_parse_optionst::instrument_goto_program()
 
   // recalculate numbers, etc.
   goto_model.goto_functions.update();
+
+  analysis_manager.output_statistics();
 }
 
 /// display command line help
@@ -1679,6 +1741,7 @@ void goto_instrument_parse_optionst::help()
     " --mm <tso,pso,rmo,power>     instruments a weak memory model\n"
     " --scc                        detects critical cycles per SCC (one thread per SCC)\n" // NOLINT(*)
     " --one-event-per-cycle        only instruments one event per cycle\n"
+    " --max-cycle-length <n>       only collects critical cycles of at most <n> events\n" // NOLINT(*)
     " --minimum-interference       instruments an optimal number of events\n"
     " --my-events                  only instruments events whose ids appear in inst.evt\n" // NOLINT(*)
     " --cfg-kill                   enables symbolic execution used to reduce spurious cycles\n" // NOLINT(*)
@@ -1709,6 +1772,13 @@ void goto_instrument_parse_optionst::help()
     " --constant-propagator        propagate constants and simplify expressions\n" // NOLINT(*)
     " --inline                     perform full inlining\n"
     " --partial-inline             perform partial inlining\n"
+    " --inline-budget <n>          inline the calls executed most often per\n"
+    "                              instruction added, adding at most <n>\n"
+    "                              instructions\n"
+    " --inline-loop-factor <n>     assume calls in a loop are executed <n> times\n" // NOLINT(*)
+    "                              as often as outside (default: 10)\n"
+    " --inline-profile <file>      use the call counts in the output of\n"
+    "                              --show-goto-symex-steps in <file>\n"
     " --function-inline <function> transitively inline all calls <function> makes\n" // NOLINT(*)
     " --no-caching                 disable caching of intermediate results during transitive function inlining\n" // NOLINT(*)
     " --log <file>                 log in json format which code segments were inlined, use with --function-inline\n" // NOLINT(*)
@@ -1725,6 +1795,8 @@ void goto_instrument_parse_optionst::help()
     " --no-system-headers          with --dump-c/--dump-cpp: generate C source expanding libc includes\n" // NOLINT(*)
     " --use-all-headers            with --dump-c/--dump-cpp: generate C source with all includes\n" // NOLINT(*)
     " --harness                    with --dump-c/--dump-cpp: include input generator in output\n" // NOLINT(*)
+    // NOLINTNEXTLINE(whitespace/line_length)
+    " --delta-base <file>          write the output as changes relative to the goto binary <file>\n"
     " --version                    show version and exit\n"
     HELP_FLUSH
     " --xml-ui                     use XML-formatted output\n"
@@ -30,6 +30,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <analyses/goto_check.h>
 
 #include "aggressive_slicer.h"
+#include "analysis_manager.h"
 #include "generate_function_bodies.h"
 #include "insert_final_assert_false.h"
 
@@ -57,7 +58,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(unwind):(unwindset):(unwindset-file):" \
   "(unwinding-assertions)(partial-loops)(continue-as-loops)" \
   "(log):" \
-  "(max-var):(max-po-trans):(ignore-arrays)" \
+  "(max-var):(max-po-trans):(max-cycle-length):(ignore-arrays)" \
   "(cfg-kill)(no-dependencies)(force-loop-duplication)" \
   "(call-graph)(reachable-call-graph)" \
   OPT_INSERT_FINAL_ASSERT_FALSE \
@@ -80,6 +81,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(full-slice)(reachability-slice)(slice-global-inits)" \
   "(fp-reachability-slice):" \
   "(inline)(partial-inline)(function-inline):(log):(no-caching)" \
+  "(inline-budget):(inline-profile):(inline-loop-factor):" \
   OPT_REMOVE_CONST_FUNCTION_POINTERS \
   "(print-internal-representation)" \
   "(remove-function-pointers)" \
@@ -109,6 +111,7 @@ Author: Daniel Kroening, kroening@kroening.com
   "(show-local-safe-pointers)(show-safe-dereferences)" \
   OPT_REPLACE_CALLS \
   "(validate-goto-binary)" \
+  "(delta-base):" \
   OPT_VALIDATE \
   OPT_ANSI_C_LANGUAGE \
   // empty last line
@@ -129,7 +132,8 @@ public:
         "goto-instrument"),
       function_pointer_removal_done(false),
       partial_inlining_done(false),
-      remove_returns_done(false)
+      remove_returns_done(false),
+      analysis_manager(goto_model, ui_message_handler)
   {
   }
 
@@ -149,6 +153,9 @@ protected:
   bool remove_returns_done;
 
   goto_modelt goto_model;
+
+  /// Analyses shared between the passes run on goto_model
+  analysis_managert analysis_manager;
 };
 
 #endif // CPROVER_GOTO_INSTRUMENT_GOTO_INSTRUMENT_PARSE_OPTIONS_H
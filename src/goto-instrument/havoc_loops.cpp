@@ -18,6 +18,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-programs/remove_skip.h>
 
+#include "analysis_manager.h"
 #include "function_modifies.h"
 #include "loop_utils.h"
 
@@ -28,11 +29,12 @@ public:
 
   havoc_loopst(
     function_modifiest &_function_modifies,
-    goto_functiont &_goto_function):
+    goto_functiont &_goto_function,
+    const natural_loops_mutablet &_natural_loops):
     goto_function(_goto_function),
     local_may_alias(_goto_function),
     function_modifies(_function_modifies),
-    natural_loops(_goto_function.body)
+    natural_loops(_natural_loops)
   {
     havoc_loops();
   }
@@ -41,7 +43,7 @@ protected:
   goto_functiont &goto_function;
   local_may_aliast local_may_alias;
   function_modifiest &function_modifies;
-  natural_loops_mutablet natural_loops;
+  const natural_loops_mutablet &natural_loops;
 
   typedef std::set<exprt> modifiest;
   typedef const natural_loops_mutablet::natural_loopt loopt;
@@ -122,5 +124,21 @@ void havoc_loops(goto_modelt &goto_model)
   function_modifiest function_modifies(goto_model.goto_functions);
 
   Forall_goto_functions(it, goto_model.goto_functions)
-    havoc_loopst(function_modifies, it->second);
+  {
+    const natural_loops_mutablet natural_loops(it->second.body);
+    havoc_loopst(function_modifies, it->second, natural_loops);
+  }
+}
+
+void havoc_loops(goto_modelt &goto_model, analysis_managert &analysis_manager)
+{
+  function_modifiest function_modifies(goto_model.goto_functions);
+
+  Forall_goto_functions(it, goto_model.goto_functions)
+  {
+    havoc_loopst(
+      function_modifies,
+      it->second,
+      analysis_manager.natural_loops(it->first));
+  }
 }
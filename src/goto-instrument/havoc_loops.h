@@ -12,8 +12,12 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_INSTRUMENT_HAVOC_LOOPS_H
 #define CPROVER_GOTO_INSTRUMENT_HAVOC_LOOPS_H
 
+class analysis_managert;
 class goto_modelt;
 
 void havoc_loops(goto_modelt &);
 
+/// As above, but the natural loops are obtained from \p analysis_manager
+void havoc_loops(goto_modelt &, analysis_managert &analysis_manager);
+
 #endif // CPROVER_GOTO_INSTRUMENT_HAVOC_LOOPS_H
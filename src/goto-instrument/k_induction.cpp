@@ -18,6 +18,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-programs/remove_skip.h>
 
+#include "analysis_manager.h"
 #include "unwind.h"
 #include "loop_utils.h"
 
@@ -27,13 +28,14 @@ public:
   k_inductiont(
     const irep_idt &_function_id,
     goto_functiont &_goto_function,
+    const natural_loops_mutablet &_natural_loops,
     bool _base_case,
     bool _step_case,
     unsigned _k)
     : function_id(_function_id),
       goto_function(_goto_function),
       local_may_alias(_goto_function),
-      natural_loops(_goto_function.body),
+      natural_loops(_natural_loops),
       base_case(_base_case),
       step_case(_step_case),
       k(_k)
@@ -45,7 +47,7 @@ protected:
   const irep_idt &function_id;
   goto_functiont &goto_function;
   local_may_aliast local_may_alias;
-  natural_loops_mutablet natural_loops;
+  const natural_loops_mutablet &natural_loops;
 
   const bool base_case, step_case;
   const unsigned k;
@@ -165,5 +167,28 @@ void k_induction(
   unsigned k)
 {
   Forall_goto_functions(it, goto_model.goto_functions)
-    k_inductiont(it->first, it->second, base_case, step_case, k);
+  {
+    const natural_loops_mutablet natural_loops(it->second.body);
+    k_inductiont(
+      it->first, it->second, natural_loops, base_case, step_case, k);
+  }
+}
+
+void k_induction(
+  goto_modelt &goto_model,
+  analysis_managert &analysis_manager,
+  bool base_case,
+  bool step_case,
+  unsigned k)
+{
+  Forall_goto_functions(it, goto_model.goto_functions)
+  {
+    k_inductiont(
+      it->first,
+      it->second,
+      analysis_manager.natural_loops(it->first),
+      base_case,
+      step_case,
+      k);
+  }
 }
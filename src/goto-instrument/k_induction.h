@@ -12,6 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_GOTO_INSTRUMENT_K_INDUCTION_H
 #define CPROVER_GOTO_INSTRUMENT_K_INDUCTION_H
 
+class analysis_managert;
 class goto_modelt;
 
 void k_induction(
@@ -19,4 +20,12 @@ void k_induction(
   bool base_case, bool step_case,
   unsigned k);
 
+/// As above, but the natural loops are obtained from \p analysis_manager
+void k_induction(
+  goto_modelt &,
+  analysis_managert &analysis_manager,
+  bool base_case,
+  bool step_case,
+  unsigned k);
+
 #endif // CPROVER_GOTO_INSTRUMENT_K_INDUCTION_H
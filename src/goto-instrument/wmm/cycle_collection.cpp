@@ -13,6 +13,8 @@ Date: 2012
 
 #include "event_graph.h"
 
+#include <algorithm>
+
 #include <util/message.h>
 
 /// after the collection, eliminates the executions forbidden by an indirect
@@ -112,6 +114,31 @@ void event_grapht::graph_explorert::collect_cycles(
   /* end of collection -- remove spurious by thin-air cycles */
   if(egraph.filter_thin_air)
     filter_thin_air(set_of_cycles);
+
+  egraph.message.statistics() << "cycles dropped as rotations of others: "
+                              << duplicate_cycles << messaget::eom;
+}
+
+std::vector<event_idt> event_grapht::critical_cyclet::signature() const
+{
+  std::vector<event_idt> result(data.begin(), data.end());
+  std::rotate(
+    result.begin(),
+    std::min_element(result.begin(), result.end()),
+    result.end());
+  return result;
+}
+
+void event_grapht::graph_explorert::add_cycle(
+  std::set<critical_cyclet> &set_of_cycles,
+  const critical_cyclet &new_cycle)
+{
+  /* the exploration from different sources may find the same cycle,
+     starting at different events */
+  if(cycle_signatures.insert(new_cycle.signature()).second)
+    set_of_cycles.insert(new_cycle);
+  else
+    ++duplicate_cycles;
 }
 
 /// extracts a (whole, unreduced) cycle from the stack. Note: it may not be a
@@ -227,6 +254,12 @@ bool event_grapht::graph_explorert::backtrack(
   if(max_var!=0 && point_stack.size()>max_var*3)
     return false;
 
+  /* if specified, maximum length of cycles reached: any cycle through this
+     vertex would need to add at least this vertex or one of its successors */
+  if(egraph.max_cycle_length!=0 &&
+     point_stack.size()>=egraph.max_cycle_length)
+    return false;
+
   /* we only explore shared variables */
   if(!this_vertex.local)
   {
@@ -398,7 +431,7 @@ bool event_grapht::graph_explorert::backtrack(
           {
             egraph.message.debug() << new_cycle.print_name(model, false)
               << messaget::eom;
-            set_of_cycles.insert(new_cycle);
+            add_cycle(set_of_cycles, new_cycle);
 #if 0
             const critical_cyclet* reduced=new_cycle.hide_internals();
             set_of_cycles.insert(*reduced);
@@ -451,7 +484,7 @@ bool event_grapht::graph_explorert::backtrack(
           {
             egraph.message.debug() << new_cycle.print_name(model, false)
               << messaget::eom;
-            set_of_cycles.insert(new_cycle);
+            add_cycle(set_of_cycles, new_cycle);
 #if 0
             const critical_cyclet* reduced=new_cycle.hide_internals();
             set_of_cycles.insert(*reduced);
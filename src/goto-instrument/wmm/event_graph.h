@@ -18,6 +18,7 @@ Date: 2012
 #include <set>
 #include <map>
 #include <iosfwd>
+#include <vector>
 
 #include <util/graph.h>
 #include <util/invariant.h>
@@ -129,6 +130,10 @@ public:
       return true;
     }
 
+    /* the events of the cycle, starting from the smallest one, such that
+       all rotations of a cycle have the same signature */
+    std::vector<event_idt> signature() const;
+
     /* removes internal events (e.g. podWW Rfi gives podWR)
        from.hide_internals(&target) */
     void hide_internals(critical_cyclet &reduced) const;
@@ -244,6 +249,7 @@ protected:
   /* parameters limiting the exploration */
   unsigned max_var;
   unsigned max_po_trans;
+  unsigned max_cycle_length;
   bool ignore_arrays;
 
   /* graph explorer (for each cycles collection) */
@@ -281,6 +287,16 @@ protected:
     /* number of cycles met so far */
     unsigned cycle_nb;
 
+    /* signatures of the cycles collected so far, and the number of cycles
+       dropped as they only differ from one of these by rotation */
+    std::set<std::vector<event_idt>> cycle_signatures;
+    unsigned duplicate_cycles;
+
+    /* adds the cycle unless a rotation of it has been collected before */
+    void add_cycle(
+      std::set<critical_cyclet> &set_of_cycles,
+      const critical_cyclet &new_cycle);
+
     /* events in thin-air executions met so far */
     /* any execution blocked by thin-air is guaranteed
        to have all its events in this set */
@@ -298,7 +314,8 @@ protected:
       egraph(_egraph),
       max_var(_max_var),
       max_po_trans(_max_po_trans),
-      cycle_nb(0)
+      cycle_nb(0),
+      duplicate_cycles(0)
     {
     }
 
@@ -383,6 +400,7 @@ public:
   explicit event_grapht(messaget &_message):
     max_var(0),
     max_po_trans(0),
+    max_cycle_length(0),
     ignore_arrays(false),
     filter_thin_air(true),
     filter_uniproc(true),
@@ -567,11 +585,13 @@ public:
   void set_parameters_collection(
     unsigned _max_var=0,
     unsigned _max_po_trans=0,
-    bool _ignore_arrays=false)
+    bool _ignore_arrays=false,
+    unsigned _max_cycle_length=0)
   {
     max_var = _max_var;
     max_po_trans = _max_po_trans;
     ignore_arrays = _ignore_arrays;
+    max_cycle_length = _max_cycle_length;
   }
 
   /* collects all the pairs of events with respectively at least one cmp,
@@ -393,9 +393,11 @@ public:
   void set_parameters_collection(
     unsigned _max_var = 0,
     unsigned _max_po_trans = 0,
-    bool _ignore_arrays = false)
+    bool _ignore_arrays = false,
+    unsigned _max_cycle_length = 0)
   {
-    egraph.set_parameters_collection(_max_var, _max_po_trans, _ignore_arrays);
+    egraph.set_parameters_collection(
+      _max_var, _max_po_trans, _ignore_arrays, _max_cycle_length);
   }
 
   /* builds the relations between unsafe pairs in the critical cycles and
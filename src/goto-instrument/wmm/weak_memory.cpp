@@ -115,6 +115,7 @@ void weak_memory(
   loop_strategyt duplicate_body,
   unsigned input_max_var,
   unsigned input_max_po_trans,
+  unsigned max_cycle_length,
   bool render_po,
   bool render_file,
   bool render_function,
@@ -155,9 +156,10 @@ void weak_memory(
   // collects cycles, directly or by SCCs
   if(input_max_var!=0 || input_max_po_trans!=0)
     instrumenter.set_parameters_collection(input_max_var,
-      input_max_po_trans, ignore_arrays);
+      input_max_po_trans, ignore_arrays, max_cycle_length);
   else
-    instrumenter.set_parameters_collection(max_thds, 0, ignore_arrays);
+    instrumenter.set_parameters_collection(
+      max_thds, 0, ignore_arrays, max_cycle_length);
 
   if(SCC)
   {
@@ -168,11 +170,12 @@ void weak_memory(
     for(unsigned i=0; i<instrumenter.num_sccs; i++)
       if(instrumenter.egraph_SCCs[i].size()>=4)
       {
-        message.status()<<"SCC #"<<i<<": "
-          <<instrumenter.set_of_cycles_per_SCC[interesting_scc++].size()
+        /* only the SCCs that can host cycles have been explored */
+        const std::size_t cycles_in_scc =
+          instrumenter.set_of_cycles_per_SCC[interesting_scc++].size();
+        message.status()<<"SCC #"<<i<<": "<<cycles_in_scc
           <<" cycles found"<<messaget::eom;
-        total_cycles += instrumenter
-          .set_of_cycles_per_SCC[interesting_scc++].size();
+        total_cycles += cycles_in_scc;
       }
 
     /* if no cycle, no need to instrument */
@@ -36,6 +36,7 @@ void weak_memory(
   loop_strategyt duplicate_body,
   unsigned max_var,
   unsigned max_po_trans,
+  unsigned max_cycle_length,
   bool render_po,
   bool render_file,
   bool render_function,
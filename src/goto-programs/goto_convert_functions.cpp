@@ -10,6 +10,8 @@ Date: June 2003
 
 #include "goto_convert_functions.h"
 
+#include <vector>
+
 #include <util/fresh_symbol.h>
 #include <util/prefix.h>
 #include <util/std_code.h>
@@ -35,8 +37,7 @@ void goto_convert_functionst::goto_convert(goto_functionst &functions)
 {
   // warning! hash-table iterators are not stable
 
-  typedef std::list<irep_idt> symbol_listt;
-  symbol_listt symbol_list;
+  std::vector<irep_idt> symbol_list;
 
   for(const auto &symbol_pair : symbol_table.symbols)
   {
@@ -11,7 +11,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "goto_inline.h"
 
+#include <algorithm>
 #include <cassert>
+#include <istream>
+#include <set>
 
 #include <util/prefix.h>
 #include <util/cprover_prefix.h>
@@ -207,6 +210,304 @@ void goto_partial_inline(
   goto_inline.goto_inline(inline_map, false);
 }
 
+void parse_symex_call_counts(
+  std::istream &in,
+  inline_cost_modelt::call_countst &call_counts)
+{
+  // On each function call, symex outputs the call stack, the last entry of
+  // which is the call site, followed by the function called:
+  //   Call stack:
+  //   __CPROVER__start location number: 23 line: 10
+  //   main location number: 7 line: 12
+  //   f
+  // Location numbers depend on how the program was processed before symex,
+  // hence call sites are identified by their caller, callee and line.
+  const std::string separator = " location number: ";
+  const std::string line_separator = " line: ";
+  bool in_call_stack = false;
+  optionalt<std::pair<irep_idt, irep_idt>> call_site;
+  std::string line;
+
+  while(std::getline(in, line))
+  {
+    if(line == "Call stack:")
+    {
+      in_call_stack = true;
+      call_site.reset();
+      continue;
+    }
+
+    if(!in_call_stack)
+      continue;
+
+    const std::size_t pos = line.find(separator);
+
+    if(pos != std::string::npos)
+    {
+      const std::size_t line_pos = line.find(line_separator, pos);
+      call_site = std::make_pair(
+        irep_idt(line.substr(0, pos)),
+        line_pos == std::string::npos
+          ? irep_idt()
+          : irep_idt(line.substr(line_pos + line_separator.size())));
+    }
+    else
+    {
+      if(call_site.has_value())
+      {
+        ++call_counts[std::make_tuple(
+          call_site->first, irep_idt(line), call_site->second)];
+      }
+      in_call_stack = false;
+    }
+  }
+}
+
+/// Inline the calls that promise the largest reduction of the cost of
+/// symbolic execution per instruction added, until the size budget of the
+/// cost model is used up. The benefit of inlining a call is taken to be
+/// proportional to the number of times the call is executed. Unless counts
+/// from a previous run are given, this number is estimated from the call
+/// graph and the loops the calls are nested in: each call site is executed
+/// as often as the function containing it, times the loop factor for each
+/// enclosing loop.
+/// \param goto_model: Source of the symbol table and function map to use.
+/// \param message_handler: Message handler used by goto_inlinet.
+/// \param cost_model: The size budget and the parameters of the estimate.
+/// \param adjust_function: Tell goto_inlinet to adjust function.
+void goto_cost_model_inline(
+  goto_modelt &goto_model,
+  message_handlert &message_handler,
+  const inline_cost_modelt &cost_model,
+  bool adjust_function)
+{
+  goto_functionst &goto_functions = goto_model.goto_functions;
+  const namespacet ns(goto_model.symbol_table);
+  messaget log(message_handler);
+
+  struct callt
+  {
+    irep_idt caller;
+    goto_programt::targett target;
+    irep_idt callee;
+    double frequency;
+  };
+
+  // calls of functions with a body, by caller
+  std::map<irep_idt, std::vector<callt>> calls;
+
+  Forall_goto_functions(f_it, goto_functions)
+  {
+    goto_programt &goto_program = f_it->second.body;
+
+    Forall_goto_program_instructions(i_it, goto_program)
+    {
+      if(!i_it->is_function_call())
+        continue;
+
+      exprt lhs;
+      exprt function_expr;
+      exprt::operandst arguments;
+      goto_inlinet::get_call(i_it, lhs, function_expr, arguments);
+
+      if(function_expr.id() != ID_symbol)
+        continue;
+
+      const irep_idt callee = to_symbol_expr(function_expr).get_identifier();
+      const auto callee_it = goto_functions.function_map.find(callee);
+
+      if(
+        callee_it != goto_functions.function_map.end() &&
+        callee_it->second.body_available())
+      {
+        calls[f_it->first].push_back({f_it->first, i_it, callee, 0});
+      }
+    }
+  }
+
+  // The depth of the functions in the call graph, starting from the entry
+  // point, or from all functions if there is none.
+  std::map<irep_idt, std::size_t> depth;
+  std::vector<irep_idt> by_depth;
+
+  if(goto_functions.function_map.count(goto_functionst::entry_point()) != 0)
+  {
+    depth[goto_functionst::entry_point()] = 0;
+    by_depth.push_back(goto_functionst::entry_point());
+  }
+  else
+  {
+    forall_goto_functions(f_it, goto_functions)
+    {
+      if(f_it->second.body_available())
+      {
+        depth[f_it->first] = 0;
+        by_depth.push_back(f_it->first);
+      }
+    }
+  }
+
+  for(std::size_t i = 0; i < by_depth.size(); ++i)
+  {
+    for(const auto &call : calls[by_depth[i]])
+    {
+      if(depth.emplace(call.callee, depth[by_depth[i]] + 1).second)
+        by_depth.push_back(call.callee);
+    }
+  }
+
+  // How often each function is executed, propagated along the call graph
+  // from smaller to larger depths.
+  std::map<irep_idt, double> weight;
+  for(const auto &function : by_depth)
+  {
+    if(depth[function] == 0)
+      weight[function] = 1;
+  }
+
+  std::vector<callt *> candidates;
+  // the entries of the profile that have been matched to a call site
+  std::set<inline_cost_modelt::call_countst::key_type> profiled_calls;
+
+  for(const auto &function : by_depth)
+  {
+    const goto_programt &goto_program =
+      goto_functions.function_map.at(function).body;
+
+    std::vector<goto_programt::const_targett> loops;
+    forall_goto_program_instructions(i_it, goto_program)
+    {
+      if(i_it->is_backwards_goto())
+        loops.push_back(i_it);
+    }
+
+    for(auto &call : calls[function])
+    {
+      if(cost_model.call_counts.empty())
+      {
+        call.frequency = weight[function];
+        for(const auto &loop : loops)
+        {
+          if(
+            loop->get_target()->location_number <=
+              call.target->location_number &&
+            call.target->location_number <= loop->location_number)
+          {
+            call.frequency *= cost_model.loop_factor;
+          }
+        }
+      }
+      else
+      {
+        const auto key = std::make_tuple(
+          function, call.callee, call.target->source_location.get_line());
+        const auto count_it = cost_model.call_counts.find(key);
+        if(count_it == cost_model.call_counts.end())
+          call.frequency = 0;
+        else
+        {
+          call.frequency = count_it->second;
+          profiled_calls.insert(key);
+        }
+      }
+
+      if(depth[call.callee] > depth[function])
+        weight[call.callee] += call.frequency;
+
+      // Don't inline any function calls made from the _start function.
+      if(
+        function != goto_functionst::entry_point() &&
+        call.callee != function && call.frequency > 0)
+      {
+        candidates.push_back(&call);
+      }
+    }
+  }
+
+  for(const auto &entry : cost_model.call_counts)
+  {
+    if(profiled_calls.count(entry.first) == 0)
+    {
+      log.warning() << "profile entry for the call of "
+                    << std::get<1>(entry.first) << " from "
+                    << std::get<0>(entry.first) << " at line "
+                    << std::get<2>(entry.first) << " matches no call site"
+                    << messaget::eom;
+    }
+  }
+
+  // number of instructions of a function, including those inlined into it
+  std::map<irep_idt, std::size_t> size;
+  // number of copies of the body of a function after inlining
+  std::map<irep_idt, std::size_t> copies;
+  forall_goto_functions(f_it, goto_functions)
+  {
+    size[f_it->first] = f_it->second.body.instructions.size();
+    copies[f_it->first] = 1;
+  }
+
+  // Rank by frequency per instruction added; among equals, prefer calls
+  // deeper in the call graph and smaller callees.
+  std::stable_sort(
+    candidates.begin(),
+    candidates.end(),
+    [&size, &depth](const callt *a, const callt *b) {
+      const double a_rank = a->frequency / (size[a->callee] + 1);
+      const double b_rank = b->frequency / (size[b->callee] + 1);
+      if(a_rank != b_rank)
+        return a_rank > b_rank;
+      if(depth[a->caller] != depth[b->caller])
+        return depth[a->caller] > depth[b->caller];
+      return size[a->callee] < size[b->callee];
+    });
+
+  std::set<const goto_programt::instructiont *> selected;
+  std::size_t growth = 0;
+
+  for(const callt *call : candidates)
+  {
+    const std::size_t call_growth =
+      size[call->callee] * copies[call->caller];
+
+    if(growth + call_growth > cost_model.size_budget)
+      continue;
+
+    growth += call_growth;
+    size[call->caller] += size[call->callee];
+    copies[call->callee] += copies[call->caller];
+    selected.insert(&*call->target);
+  }
+
+  log.statistics() << "Inlining " << selected.size() << " of "
+                   << candidates.size() << " calls, adding about " << growth
+                   << " instructions" << messaget::eom;
+
+  // the calls to inline in the order of their location numbers
+  goto_inlinet::inline_mapt inline_map;
+
+  Forall_goto_functions(f_it, goto_functions)
+  {
+    if(
+      !f_it->second.body_available() ||
+      f_it->first == goto_functionst::entry_point())
+    {
+      continue;
+    }
+
+    goto_inlinet::call_listt &call_list = inline_map[f_it->first];
+
+    Forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      if(selected.count(&*i_it) != 0)
+        call_list.push_back(goto_inlinet::callt(i_it, false));
+    }
+  }
+
+  goto_inlinet goto_inline(
+    goto_functions, ns, message_handler, adjust_function);
+  goto_inline.goto_inline(inline_map, false);
+}
+
 /// Inline all function calls made from a particular function
 /// \param goto_model: Source of the symbol table and function map to use.
 /// \param function: The function whose calls to inline.
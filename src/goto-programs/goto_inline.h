@@ -14,6 +14,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/json.h>
 
+#include <iosfwd>
+#include <map>
+#include <tuple>
+
 #include "goto_model.h"
 
 class message_handlert;
@@ -47,6 +51,40 @@ void goto_partial_inline(
   unsigned smallfunc_limit=0,
   bool adjust_function=false);
 
+/// Parameters of the cost model that \ref goto_cost_model_inline uses to
+/// choose the calls to inline
+struct inline_cost_modelt
+{
+  /// The number of instructions the program may grow by
+  std::size_t size_budget = 0;
+
+  /// How many more times a call is assumed to be executed for each loop that
+  /// it is nested in
+  std::size_t loop_factor = 10;
+
+  /// The number of times call sites, given by the calling function, the
+  /// function called and the line of the call, were executed in a previous
+  /// run of symex. If not empty, these counts replace the static estimate.
+  typedef std::map<std::tuple<irep_idt, irep_idt, irep_idt>, std::size_t>
+    call_countst;
+  call_countst call_counts;
+};
+
+/// Add the number of times each call site was executed to \p call_counts,
+/// reading the output of symex with --show-goto-symex-steps from \p in
+void parse_symex_call_counts(
+  std::istream &in,
+  inline_cost_modelt::call_countst &call_counts);
+
+// inline the calls that are executed most often per instruction added,
+// until the size budget is used up
+
+void goto_cost_model_inline(
+  goto_modelt &goto_model,
+  message_handlert &message_handler,
+  const inline_cost_modelt &cost_model,
+  bool adjust_function=false);
+
 // transitively inline all calls the given function makes
 
 void goto_function_inline(
@@ -107,9 +107,12 @@ lazy_goto_modelt::lazy_goto_modelt(lazy_goto_modelt &&other)
 /// for more detail.
 /// \param files: source files and GOTO binaries to load
 /// \param options: options to pass on to the language front-ends
+/// \param configure_language: if given, called on each language front-end
+///   after its options are set
 void lazy_goto_modelt::initialize(
   const std::vector<std::string> &files,
-  const optionst &options)
+  const optionst &options,
+  const configure_languaget &configure_language)
 {
   messaget msg(message_handler);
 
@@ -162,6 +165,8 @@ void lazy_goto_modelt::initialize(
       languaget &language=*lf.language;
       language.set_message_handler(message_handler);
       language.set_language_options(options);
+      if(configure_language)
+        configure_language(language);
 
       msg.status() << "Parsing " << filename << messaget::eom;
 
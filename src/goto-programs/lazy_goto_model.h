@@ -178,8 +178,14 @@ public:
       message_handler);
   }
 
-  void
-  initialize(const std::vector<std::string> &files, const optionst &options);
+  /// Callback function that configures a language front-end beyond what
+  /// the options allow, before it parses a source file
+  typedef std::function<void(languaget &language)> configure_languaget;
+
+  void initialize(
+    const std::vector<std::string> &files,
+    const optionst &options,
+    const configure_languaget &configure_language = {});
 
   /// Eagerly loads all functions from the symbol table.
   void load_all_functions() const;
@@ -13,163 +13,188 @@ Date: June 2006
 
 #include "read_bin_goto_object.h"
 
-#include <util/namespace.h>
+#include <util/irep_serialization.h>
+#include <util/journalling_symbol_table.h>
 #include <util/message.h>
+#include <util/namespace.h>
 #include <util/symbol_table.h>
-#include <util/irep_serialization.h>
 
 #include "goto_functions.h"
 #include "write_goto_binary.h"
 
-/// read goto binary format
-/// \par parameters: input stream, symbol_table, functions
-/// \return true on error, false otherwise
-static bool read_bin_goto_object(
+/// read a symbol in goto binary format
+static symbolt
+read_symbol(std::istream &in, irep_serializationt &irepconverter)
+{
+  symbolt sym;
+
+  sym.type = static_cast<const typet &>(irepconverter.reference_convert(in));
+  sym.value = static_cast<const exprt &>(irepconverter.reference_convert(in));
+  sym.location = static_cast<const source_locationt &>(
+    irepconverter.reference_convert(in));
+
+  sym.name = irepconverter.read_string_ref(in);
+  sym.module = irepconverter.read_string_ref(in);
+  sym.base_name = irepconverter.read_string_ref(in);
+  sym.mode = irepconverter.read_string_ref(in);
+  sym.pretty_name = irepconverter.read_string_ref(in);
+
+  // obsolete: symordering
+  irepconverter.read_gb_word(in);
+
+  std::size_t flags=irepconverter.read_gb_word(in);
+
+  sym.is_weak = (flags &(1 << 16))!=0;
+  sym.is_type = (flags &(1 << 15))!=0;
+  sym.is_property = (flags &(1 << 14))!=0;
+  sym.is_macro = (flags &(1 << 13))!=0;
+  sym.is_exported = (flags &(1 << 12))!=0;
+  sym.is_input = (flags &(1 << 11))!=0;
+  sym.is_output = (flags &(1 << 10))!=0;
+  sym.is_state_var = (flags &(1 << 9))!=0;
+  sym.is_parameter = (flags &(1 << 8))!=0;
+  sym.is_auxiliary = (flags &(1 << 7))!=0;
+  // sym.binding = (flags &(1 << 6))!=0;
+  sym.is_lvalue = (flags &(1 << 5))!=0;
+  sym.is_static_lifetime = (flags &(1 << 4))!=0;
+  sym.is_thread_local = (flags &(1 << 3))!=0;
+  sym.is_file_local = (flags &(1 << 2))!=0;
+  sym.is_extern = (flags &(1 << 1))!=0;
+  sym.is_volatile = (flags &1)!=0;
+
+  return sym;
+}
+
+/// makes sure there is a function with the type of \p sym in \p functions,
+/// if \p sym is a function symbol
+static void
+add_function_entry(const symbolt &sym, goto_functionst &functions)
+{
+  if(!sym.is_type && sym.type.id()==ID_code)
+  {
+    auto entry = functions.function_map.emplace(sym.name, goto_functiont());
+
+    const code_typet &code_type = to_code_type(sym.type);
+    entry.first->second.type = code_type;
+    entry.first->second.set_parameter_identifiers(code_type);
+  }
+}
+
+/// read a function body in goto binary format, replacing any body the
+/// function had before
+static void read_function_body(
   std::istream &in,
-  symbol_tablet &symbol_table,
+  symbol_table_baset &symbol_table,
   goto_functionst &functions,
   irep_serializationt &irepconverter)
 {
-  std::size_t count = irepconverter.read_gb_word(in); // # of symbols
+  irep_idt fname=irepconverter.read_gb_string(in);
+  goto_functionst::goto_functiont &f = functions.function_map[fname];
+  f.body.clear();
 
-  for(std::size_t i=0; i<count; i++)
+  typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
+  target_mapt target_map;
+  typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
+  rev_target_mapt rev_target_map;
+
+  bool hidden=false;
+
+  std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
+  for(std::size_t ins_index = 0; ins_index < ins_count; ++ins_index)
   {
-    symbolt sym;
+    goto_programt::targett itarget = f.body.add_instruction();
+    goto_programt::instructiont &instruction=*itarget;
 
-    sym.type = static_cast<const typet &>(irepconverter.reference_convert(in));
-    sym.value = static_cast<const exprt &>(irepconverter.reference_convert(in));
-    sym.location = static_cast<const source_locationt &>(
+    instruction.code =
+      static_cast<const codet &>(irepconverter.reference_convert(in));
+    instruction.source_location = static_cast<const source_locationt &>(
       irepconverter.reference_convert(in));
-
-    sym.name = irepconverter.read_string_ref(in);
-    sym.module = irepconverter.read_string_ref(in);
-    sym.base_name = irepconverter.read_string_ref(in);
-    sym.mode = irepconverter.read_string_ref(in);
-    sym.pretty_name = irepconverter.read_string_ref(in);
-
-    // obsolete: symordering
-    irepconverter.read_gb_word(in);
-
-    std::size_t flags=irepconverter.read_gb_word(in);
-
-    sym.is_weak = (flags &(1 << 16))!=0;
-    sym.is_type = (flags &(1 << 15))!=0;
-    sym.is_property = (flags &(1 << 14))!=0;
-    sym.is_macro = (flags &(1 << 13))!=0;
-    sym.is_exported = (flags &(1 << 12))!=0;
-    sym.is_input = (flags &(1 << 11))!=0;
-    sym.is_output = (flags &(1 << 10))!=0;
-    sym.is_state_var = (flags &(1 << 9))!=0;
-    sym.is_parameter = (flags &(1 << 8))!=0;
-    sym.is_auxiliary = (flags &(1 << 7))!=0;
-    // sym.binding = (flags &(1 << 6))!=0;
-    sym.is_lvalue = (flags &(1 << 5))!=0;
-    sym.is_static_lifetime = (flags &(1 << 4))!=0;
-    sym.is_thread_local = (flags &(1 << 3))!=0;
-    sym.is_file_local = (flags &(1 << 2))!=0;
-    sym.is_extern = (flags &(1 << 1))!=0;
-    sym.is_volatile = (flags &1)!=0;
-
-    if(!sym.is_type && sym.type.id()==ID_code)
+    instruction.type = (goto_program_instruction_typet)
+                            irepconverter.read_gb_word(in);
+    instruction.guard =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    instruction.target_number = irepconverter.read_gb_word(in);
+    if(instruction.is_target() &&
+       rev_target_map.insert(
+         rev_target_map.end(),
+         std::make_pair(instruction.target_number, itarget))->second!=itarget)
+      UNREACHABLE;
+
+    std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
+    for(std::size_t i=0; i<t_count; i++)
+      // just save the target numbers
+      target_map[itarget].push_back(irepconverter.read_gb_word(in));
+
+    std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
+
+    for(std::size_t i=0; i<l_count; i++)
     {
-      // makes sure there is an empty function for every function symbol
-      auto entry = functions.function_map.emplace(sym.name, goto_functiont());
-
-      const code_typet &code_type = to_code_type(sym.type);
-      entry.first->second.type = code_type;
-      entry.first->second.set_parameter_identifiers(code_type);
+      irep_idt label=irepconverter.read_string_ref(in);
+      instruction.labels.push_back(label);
+      if(label == CPROVER_PREFIX "HIDE")
+        hidden=true;
+      // The above info is normally in the type of the goto_functiont object,
+      // which should likely be stored in the binary.
     }
-
-    symbol_table.add(sym);
   }
 
-  count=irepconverter.read_gb_word(in); // # of functions
-
-  for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
+  // Resolve targets
+  for(target_mapt::iterator tit = target_map.begin();
+      tit!=target_map.end();
+      tit++)
   {
-    irep_idt fname=irepconverter.read_gb_string(in);
-    goto_functionst::goto_functiont &f = functions.function_map[fname];
-
-    typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
-    target_mapt target_map;
-    typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
-    rev_target_mapt rev_target_map;
+    goto_programt::targett ins = tit->first;
 
-    bool hidden=false;
-
-    std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
-    for(std::size_t ins_index = 0; ins_index < ins_count; ++ins_index)
+    for(std::list<unsigned>::iterator nit = tit->second.begin();
+        nit!=tit->second.end();
+        nit++)
     {
-      goto_programt::targett itarget = f.body.add_instruction();
-      goto_programt::instructiont &instruction=*itarget;
-
-      instruction.code =
-        static_cast<const codet &>(irepconverter.reference_convert(in));
-      instruction.source_location = static_cast<const source_locationt &>(
-        irepconverter.reference_convert(in));
-      instruction.type = (goto_program_instruction_typet)
-                              irepconverter.read_gb_word(in);
-      instruction.guard =
-        static_cast<const exprt &>(irepconverter.reference_convert(in));
-      instruction.target_number = irepconverter.read_gb_word(in);
-      if(instruction.is_target() &&
-         rev_target_map.insert(
-           rev_target_map.end(),
-           std::make_pair(instruction.target_number, itarget))->second!=itarget)
-        UNREACHABLE;
-
-      std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
-      for(std::size_t i=0; i<t_count; i++)
-        // just save the target numbers
-        target_map[itarget].push_back(irepconverter.read_gb_word(in));
-
-      std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
-
-      for(std::size_t i=0; i<l_count; i++)
-      {
-        irep_idt label=irepconverter.read_string_ref(in);
-        instruction.labels.push_back(label);
-        if(label == CPROVER_PREFIX "HIDE")
-          hidden=true;
-        // The above info is normally in the type of the goto_functiont object,
-        // which should likely be stored in the binary.
-      }
-    }
-
-    // Resolve targets
-    for(target_mapt::iterator tit = target_map.begin();
-        tit!=target_map.end();
-        tit++)
-    {
-      goto_programt::targett ins = tit->first;
-
-      for(std::list<unsigned>::iterator nit = tit->second.begin();
-          nit!=tit->second.end();
-          nit++)
-      {
-        unsigned n=*nit;
-        rev_target_mapt::const_iterator entry=rev_target_map.find(n);
-        INVARIANT(
-          entry != rev_target_map.end(),
-          "something from the target map should also be in the reverse target "
-          "map");
-        ins->targets.push_back(entry->second);
-      }
+      unsigned n=*nit;
+      rev_target_mapt::const_iterator entry=rev_target_map.find(n);
+      INVARIANT(
+        entry != rev_target_map.end(),
+        "something from the target map should also be in the reverse target "
+        "map");
+      ins->targets.push_back(entry->second);
     }
+  }
 
-    f.body.update();
+  f.body.update();
 
-    if(hidden)
-    {
-      f.make_hidden();
-      // can be removed with the next goto-binary version update as the
-      // information is guaranteed to be stored in the symbol table
+  if(hidden)
+  {
+    f.make_hidden();
+    // can be removed with the next goto-binary version update as the
+    // information is guaranteed to be stored in the symbol table
 #if GOTO_BINARY_VERSION > 5
 #error This code should be removed
 #endif
-      symbol_table.get_writeable_ref(fname).set_hidden();
-    }
+    symbol_table.get_writeable_ref(fname).set_hidden();
   }
+}
+
+/// read goto binary format
+/// \par parameters: input stream, symbol_table, functions
+/// \return true on error, false otherwise
+static bool read_bin_goto_object(
+  std::istream &in,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  irep_serializationt &irepconverter)
+{
+  std::size_t count = irepconverter.read_gb_word(in); // # of symbols
+
+  for(std::size_t i=0; i<count; i++)
+  {
+    symbolt sym = read_symbol(in, irepconverter);
+    add_function_entry(sym, functions);
+    symbol_table.add(sym);
+  }
+
+  count=irepconverter.read_gb_word(in); // # of functions
+
+  for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
+    read_function_body(in, symbol_table, functions, irepconverter);
 
   functions.compute_location_numbers();
 
@@ -254,3 +279,144 @@ bool read_bin_goto_object(
 
   return false;
 }
+
+/// reads the header of a goto binary delta
+/// \param in: input stream, positioned at the start of the delta
+/// \param filename: file name of the delta, for diagnostics
+/// \param [out] base_file_name: the goto binary the delta applies to
+/// \param [out] base_hash: the \ref goto_binary_file_hash of that goto
+///   binary when the delta was written
+/// \param message_handler: for diagnostics
+/// \return true on error, false otherwise
+bool read_bin_goto_delta_header(
+  std::istream &in,
+  const std::string &filename,
+  std::string &base_file_name,
+  std::size_t &base_hash,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  char hdr[4];
+  in.read(hdr, 4);
+
+  if(!in || hdr[0] != 0x7f || hdr[1] != 'G' || hdr[2] != 'B' || hdr[3] != 'D')
+  {
+    message.error() << "'" << filename << "' is not a goto-binary delta"
+                    << messaget::eom;
+    return true;
+  }
+
+  std::size_t version = irep_serializationt::read_gb_word(in);
+
+  if(version != GOTO_BINARY_VERSION)
+  {
+    message.error() << "The delta '" << filename
+                    << "' was written by an unsupported version of "
+                       "goto-instrument; please recreate it"
+                    << messaget::eom;
+    return true;
+  }
+
+  irep_serializationt::ireps_containert ic;
+  base_file_name = id2string(irep_serializationt(ic).read_gb_string(in));
+  base_hash = irep_serializationt::read_gb_word(in);
+
+  return !in;
+}
+
+/// applies the changes of a goto binary delta to the symbol table and
+/// functions read from its base
+/// \param in: input stream, positioned after the header of the delta
+/// \param filename: file name of the delta, for diagnostics
+/// \param symbol_table: symbol table of the base, to be updated
+/// \param functions: functions of the base, to be updated
+/// \param message_handler: for diagnostics
+/// \return true on error, false otherwise
+bool read_bin_goto_delta(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  irep_serializationt::ireps_containert ic;
+  irep_serializationt irepconverter(ic);
+
+  const auto mismatch = [&message, &filename]() {
+    message.error() << "The delta '" << filename
+                    << "' does not match its base goto binary" << messaget::eom;
+    return true;
+  };
+
+  journalling_symbol_tablet journal =
+    journalling_symbol_tablet::wrap(symbol_table);
+
+  std::size_t count = irepconverter.read_gb_word(in); // # of removed symbols
+
+  for(std::size_t i = 0; i < count; ++i)
+  {
+    const irep_idt name = irepconverter.read_string_ref(in);
+    if(journal.remove(name))
+      return mismatch();
+    functions.function_map.erase(name);
+  }
+
+  count = irepconverter.read_gb_word(in); // # of new or changed symbols
+
+  for(std::size_t i = 0; i < count; ++i)
+  {
+    const bool is_update = irepconverter.read_gb_word(in) != 0;
+    symbolt sym = read_symbol(in, irepconverter);
+    add_function_entry(sym, functions);
+
+    if(is_update)
+    {
+      symbolt *existing = journal.get_writeable(sym.name);
+      if(existing == nullptr)
+        return mismatch();
+      *existing = std::move(sym);
+    }
+    else if(!journal.insert(std::move(sym)).second)
+      return mismatch();
+  }
+
+  count = irepconverter.read_gb_word(in); // # of removed function bodies
+
+  for(std::size_t i = 0; i < count; ++i)
+  {
+    // functions whose symbol was removed are already gone
+    const irep_idt name = irepconverter.read_string_ref(in);
+    auto entry = functions.function_map.find(name);
+    if(entry != functions.function_map.end())
+      entry->second.body.clear();
+  }
+
+  count = irepconverter.read_gb_word(in); // # of new or changed bodies
+
+  for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
+    read_function_body(in, journal, functions, irepconverter);
+
+  if(!in)
+  {
+    message.error() << "Failed to read delta '" << filename << "'"
+                    << messaget::eom;
+    return true;
+  }
+
+  functions.compute_location_numbers();
+
+  // the journal marks inserted symbols as updated as well
+  const std::size_t inserted = journal.get_inserted().size();
+  const std::size_t updated = journal.get_updated().size() - inserted;
+
+  message.statistics() << "Applied delta '" << filename << "': " << inserted
+                       << " symbols inserted, " << updated << " updated, "
+                       << journal.get_removed().size() << " removed, "
+                       << count << " function bodies replaced"
+                       << messaget::eom;
+
+  return false;
+}
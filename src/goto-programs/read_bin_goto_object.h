@@ -28,4 +28,18 @@ bool read_bin_goto_object(
   goto_functionst &goto_functions,
   message_handlert &message_handler);
 
+bool read_bin_goto_delta_header(
+  std::istream &in,
+  const std::string &filename,
+  std::string &base_file_name,
+  std::size_t &base_hash,
+  message_handlert &message_handler);
+
+bool read_bin_goto_delta(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  message_handlert &message_handler);
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_BIN_GOTO_OBJECT_H
@@ -19,12 +19,14 @@ Author:
 #include <util/tempfile.h>
 #include <util/rename_symbol.h>
 #include <util/config.h>
+#include <util/file_util.h>
 
 #include "goto_model.h"
 #include "link_goto_model.h"
 #include "read_bin_goto_object.h"
 #include "elf_reader.h"
 #include "osx_fat_reader.h"
+#include "write_goto_binary.h"
 
 static bool read_goto_binary(
   const std::string &filename,
@@ -92,6 +94,49 @@ static bool read_goto_binary(
     return read_bin_goto_object(
       in, filename, symbol_table, goto_functions, message_handler);
   }
+  else if(hdr[0]==0x7f && hdr[1]=='G' && hdr[2]=='B' && hdr[3]=='D')
+  {
+    // delta relative to another goto binary
+    std::string base_file_name;
+    std::size_t base_hash;
+    if(read_bin_goto_delta_header(
+         in, filename, base_file_name, base_hash, message_handler))
+    {
+      return true;
+    }
+
+    // a relative name of the base is relative to the directory of the delta
+    const std::size_t separator = filename.find_last_of("/\\");
+    if(separator != std::string::npos)
+    {
+      base_file_name =
+        concat_dir_file(filename.substr(0, separator), base_file_name);
+    }
+
+    if(base_file_name == filename)
+    {
+      message.error() << "The delta '" << filename << "' refers to itself"
+                      << messaget::eom;
+      return true;
+    }
+
+    if(goto_binary_file_hash(base_file_name) != base_hash)
+    {
+      message.error() << "The delta '" << filename
+                      << "' does not match its base goto binary '"
+                      << base_file_name << "'" << messaget::eom;
+      return true;
+    }
+
+    if(read_goto_binary(
+         base_file_name, symbol_table, goto_functions, message_handler))
+    {
+      return true;
+    }
+
+    return read_bin_goto_delta(
+      in, filename, symbol_table, goto_functions, message_handler);
+  }
   else if(hdr[0]==0x7f && hdr[1]=='E' && hdr[2]=='L' && hdr[3]=='F')
   {
     // ELF binary.
@@ -200,16 +245,19 @@ bool is_goto_binary(
   if(!in)
     return false;
 
-  // We accept two forms:
+  // We accept three forms:
   // 1. goto binaries, marked with 0x7f GBF
-  // 2. ELF binaries, marked with 0x7f ELF
+  // 2. goto binary deltas, marked with 0x7f GBD
+  // 3. ELF binaries, marked with 0x7f ELF
 
   char hdr[8];
   in.read(hdr, 8);
   if(!in)
     return false;
 
-  if(hdr[0]==0x7f && hdr[1]=='G' && hdr[2]=='B' && hdr[3]=='F')
+  if(
+    hdr[0] == 0x7f && hdr[1] == 'G' && hdr[2] == 'B' &&
+    (hdr[3] == 'F' || hdr[3] == 'D'))
   {
     return true; // yes, this is a goto binary
   }
@@ -237,6 +237,67 @@ static void process_this_argument(
   }
 }
 
+/// Dispatch tables with more class identifier tests than this are lowered to
+/// a balanced decision tree rather than to a chain of tests
+static const std::size_t max_linear_dispatch_tests = 8;
+
+/// Class identifier tests of a dispatch table, paired with the call each one
+/// selects; the tests are mutually exclusive
+typedef std::vector<std::pair<exprt, goto_programt::targett>>
+  dispatch_testst;
+
+/// Emit a balanced decision tree selecting among \p tests in the range
+/// [\p begin, \p end). Each inner node jumps to its left subtree if one of the
+/// tests in its left half holds, so that any call is selected after a
+/// number of GOTOs logarithmic in the number of tests.
+/// \param tests: class identifier tests and the calls they select
+/// \param begin: first test of the range
+/// \param end: one past the last test of the range
+/// \param in_range: whether one of the tests in the range is known to hold
+/// \param default_target: where to go if none of the tests holds
+/// \param source_location: location of the virtual function call
+/// \param [out] dest: program the decision tree is appended to
+static void build_dispatch_tree(
+  const dispatch_testst &tests,
+  std::size_t begin,
+  std::size_t end,
+  bool in_range,
+  goto_programt::targett default_target,
+  const source_locationt &source_location,
+  goto_programt &dest)
+{
+  PRECONDITION(begin < end);
+
+  if(end - begin == 1)
+  {
+    const exprt condition = in_range ? true_exprt() : tests[begin].first;
+    dest.add(goto_programt::make_goto(
+      tests[begin].second, condition, source_location));
+    if(!in_range)
+    {
+      dest.add(goto_programt::make_goto(
+        default_target, true_exprt(), source_location));
+    }
+    return;
+  }
+
+  const std::size_t middle = begin + (end - begin) / 2;
+
+  goto_programt left;
+  build_dispatch_tree(
+    tests, begin, middle, true, default_target, source_location, left);
+
+  exprt::operandst left_tests;
+  for(std::size_t i = begin; i < middle; ++i)
+    left_tests.push_back(tests[i].first);
+  dest.add(goto_programt::make_goto(
+    left.instructions.begin(), disjunction(left_tests), source_location));
+
+  build_dispatch_tree(
+    tests, middle, end, in_range, default_target, source_location, dest);
+  dest.destructive_append(left);
+}
+
 /// Replace virtual function call with a static function call
 /// Achieved by substituting a virtual function with its most derived
 /// implementation. If there's a type mismatch between implementation
@@ -428,6 +489,28 @@ static goto_programt::targett replace_virtual_function_with_dispatch_table(
     }
   }
 
+  // A chain of tests makes symex split on every one of them in turn, which
+  // for call sites with many overrides, such as Object.equals, leads to long
+  // guards. Tests in a balanced tree are only as deep as its height, and
+  // symex prunes a whole subtree when the value set of `this` decides the
+  // test at its root.
+  if(new_code_gotos.instructions.size() > max_linear_dispatch_tests)
+  {
+    dispatch_testst tests;
+    for(const auto &instruction : new_code_gotos.instructions)
+      tests.emplace_back(instruction.get_condition(), instruction.get_target());
+
+    new_code_gotos.clear();
+    build_dispatch_tree(
+      tests,
+      0,
+      tests.size(),
+      false,
+      new_code_calls.instructions.begin(),
+      vcall_source_loc,
+      new_code_gotos);
+  }
+
   goto_programt new_code;
 
   // patch them all together
@@ -11,16 +11,99 @@ Author: CM Wintersteiger
 
 #include "write_goto_binary.h"
 
+#include <cstdint>
 #include <fstream>
 
 #include <util/exception_utils.h>
+#include <util/file_util.h>
 #include <util/invariant.h>
 #include <util/irep_serialization.h>
+#include <util/journalling_symbol_table.h>
 #include <util/message.h>
+#include <util/prefix.h>
 #include <util/symbol_table.h>
+#include <util/unicode.h>
 
 #include <goto-programs/goto_model.h>
 
+/// Writes a symbol in goto binary format
+static void write_symbol(
+  std::ostream &out,
+  const symbolt &sym,
+  irep_serializationt &irepconverter)
+{
+  // Since version 2, symbols are not converted to ireps,
+  // instead they are saved in a custom binary format
+
+  irepconverter.reference_convert(sym.type, out);
+  irepconverter.reference_convert(sym.value, out);
+  irepconverter.reference_convert(sym.location, out);
+
+  irepconverter.write_string_ref(out, sym.name);
+  irepconverter.write_string_ref(out, sym.module);
+  irepconverter.write_string_ref(out, sym.base_name);
+  irepconverter.write_string_ref(out, sym.mode);
+  irepconverter.write_string_ref(out, sym.pretty_name);
+
+  write_gb_word(out, 0); // old: sym.ordering
+
+  unsigned flags=0;
+  flags = (flags << 1) | static_cast<int>(sym.is_weak);
+  flags = (flags << 1) | static_cast<int>(sym.is_type);
+  flags = (flags << 1) | static_cast<int>(sym.is_property);
+  flags = (flags << 1) | static_cast<int>(sym.is_macro);
+  flags = (flags << 1) | static_cast<int>(sym.is_exported);
+  flags = (flags << 1) | static_cast<int>(sym.is_input);
+  flags = (flags << 1) | static_cast<int>(sym.is_output);
+  flags = (flags << 1) | static_cast<int>(sym.is_state_var);
+  flags = (flags << 1) | static_cast<int>(sym.is_parameter);
+  flags = (flags << 1) | static_cast<int>(sym.is_auxiliary);
+  flags = (flags << 1) | static_cast<int>(false); // sym.binding;
+  flags = (flags << 1) | static_cast<int>(sym.is_lvalue);
+  flags = (flags << 1) | static_cast<int>(sym.is_static_lifetime);
+  flags = (flags << 1) | static_cast<int>(sym.is_thread_local);
+  flags = (flags << 1) | static_cast<int>(sym.is_file_local);
+  flags = (flags << 1) | static_cast<int>(sym.is_extern);
+  flags = (flags << 1) | static_cast<int>(sym.is_volatile);
+
+  write_gb_word(out, flags);
+}
+
+/// Writes the body of function \p name in goto binary format
+static void write_function_body(
+  std::ostream &out,
+  const irep_idt &name,
+  const goto_programt &body,
+  irep_serializationt &irepconverter)
+{
+  // Since version 2, goto functions are not converted to ireps,
+  // instead they are saved in a custom binary format
+
+  write_gb_string(out, id2string(name)); // name
+  write_gb_word(out, body.instructions.size()); // # instructions
+
+  forall_goto_program_instructions(i_it, body)
+  {
+    const goto_programt::instructiont &instruction = *i_it;
+
+    irepconverter.reference_convert(instruction.code, out);
+    irepconverter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, (long)instruction.type);
+    irepconverter.reference_convert(instruction.guard, out);
+    write_gb_word(out, instruction.target_number);
+
+    write_gb_word(out, instruction.targets.size());
+
+    for(const auto &t_it : instruction.targets)
+      write_gb_word(out, t_it->target_number);
+
+    write_gb_word(out, instruction.labels.size());
+
+    for(const auto &l_it : instruction.labels)
+      irepconverter.write_string_ref(out, l_it);
+  }
+}
+
 /// Writes a goto program to disc, using goto binary format
 bool write_goto_binary(
   std::ostream &out,
@@ -33,45 +116,7 @@ bool write_goto_binary(
   write_gb_word(out, symbol_table.symbols.size());
 
   for(const auto &symbol_pair : symbol_table.symbols)
-  {
-    // Since version 2, symbols are not converted to ireps,
-    // instead they are saved in a custom binary format
-
-    const symbolt &sym = symbol_pair.second;
-
-    irepconverter.reference_convert(sym.type, out);
-    irepconverter.reference_convert(sym.value, out);
-    irepconverter.reference_convert(sym.location, out);
-
-    irepconverter.write_string_ref(out, sym.name);
-    irepconverter.write_string_ref(out, sym.module);
-    irepconverter.write_string_ref(out, sym.base_name);
-    irepconverter.write_string_ref(out, sym.mode);
-    irepconverter.write_string_ref(out, sym.pretty_name);
-
-    write_gb_word(out, 0); // old: sym.ordering
-
-    unsigned flags=0;
-    flags = (flags << 1) | static_cast<int>(sym.is_weak);
-    flags = (flags << 1) | static_cast<int>(sym.is_type);
-    flags = (flags << 1) | static_cast<int>(sym.is_property);
-    flags = (flags << 1) | static_cast<int>(sym.is_macro);
-    flags = (flags << 1) | static_cast<int>(sym.is_exported);
-    flags = (flags << 1) | static_cast<int>(sym.is_input);
-    flags = (flags << 1) | static_cast<int>(sym.is_output);
-    flags = (flags << 1) | static_cast<int>(sym.is_state_var);
-    flags = (flags << 1) | static_cast<int>(sym.is_parameter);
-    flags = (flags << 1) | static_cast<int>(sym.is_auxiliary);
-    flags = (flags << 1) | static_cast<int>(false); // sym.binding;
-    flags = (flags << 1) | static_cast<int>(sym.is_lvalue);
-    flags = (flags << 1) | static_cast<int>(sym.is_static_lifetime);
-    flags = (flags << 1) | static_cast<int>(sym.is_thread_local);
-    flags = (flags << 1) | static_cast<int>(sym.is_file_local);
-    flags = (flags << 1) | static_cast<int>(sym.is_extern);
-    flags = (flags << 1) | static_cast<int>(sym.is_volatile);
-
-    write_gb_word(out, flags);
-  }
+    write_symbol(out, symbol_pair.second, irepconverter);
 
   // now write functions, but only those with body
 
@@ -85,34 +130,7 @@ bool write_goto_binary(
   for(const auto &fct : goto_functions.function_map)
   {
     if(fct.second.body_available())
-    {
-      // Since version 2, goto functions are not converted to ireps,
-      // instead they are saved in a custom binary format
-
-      write_gb_string(out, id2string(fct.first)); // name
-      write_gb_word(out, fct.second.body.instructions.size()); // # instructions
-
-      forall_goto_program_instructions(i_it, fct.second.body)
-      {
-        const goto_programt::instructiont &instruction = *i_it;
-
-        irepconverter.reference_convert(instruction.code, out);
-        irepconverter.reference_convert(instruction.source_location, out);
-        write_gb_word(out, (long)instruction.type);
-        irepconverter.reference_convert(instruction.guard, out);
-        write_gb_word(out, instruction.target_number);
-
-        write_gb_word(out, instruction.targets.size());
-
-        for(const auto &t_it : instruction.targets)
-          write_gb_word(out, t_it->target_number);
-
-        write_gb_word(out, instruction.labels.size());
-
-        for(const auto &l_it : instruction.labels)
-          irepconverter.write_string_ref(out, l_it);
-      }
-    }
+      write_function_body(out, fct.first, fct.second.body, irepconverter);
   }
 
   // irepconverter.output_map(f);
@@ -177,3 +195,323 @@ bool write_goto_binary(
 
   return write_goto_binary(out, goto_model);
 }
+
+optionalt<std::size_t> goto_binary_file_hash(const std::string &filename)
+{
+#ifdef _MSC_VER
+  std::ifstream in(widen(filename), std::ios::binary);
+#else
+  std::ifstream in(filename, std::ios::binary);
+#endif
+
+  if(!in)
+    return {};
+
+  // 64-bit FNV-1a, which is independent of the string table of this run
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  char buffer[4096];
+
+  while(in.read(buffer, sizeof(buffer)) || in.gcount() > 0)
+  {
+    for(std::streamsize i = 0; i < in.gcount(); ++i)
+    {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 0x100000001b3ULL;
+    }
+  }
+
+  return static_cast<std::size_t>(hash);
+}
+
+/// Returns true if \p a and \p b are written to the same goto binary
+/// representation, including comments in the ireps
+static bool same_symbol(const symbolt &a, const symbolt &b)
+{
+  return a == b && a.type.full_eq(b.type) && a.value.full_eq(b.value) &&
+         a.location.full_eq(b.location);
+}
+
+/// Returns true if \p a and \p b are written to the same goto binary
+/// representation, including comments in the ireps
+static bool same_body(const goto_programt &a, const goto_programt &b)
+{
+  if(a.instructions.size() != b.instructions.size())
+    return false;
+
+  auto b_it = b.instructions.begin();
+  for(const auto &instruction : a.instructions)
+  {
+    if(
+      instruction.type != b_it->type ||
+      instruction.target_number != b_it->target_number ||
+      instruction.targets.size() != b_it->targets.size() ||
+      instruction.labels != b_it->labels ||
+      !instruction.code.full_eq(b_it->code) ||
+      !instruction.guard.full_eq(b_it->guard) ||
+      !instruction.source_location.full_eq(b_it->source_location))
+    {
+      return false;
+    }
+
+    auto b_target_it = b_it->targets.begin();
+    for(const auto &target : instruction.targets)
+    {
+      if(target->target_number != (*b_target_it)->target_number)
+        return false;
+      ++b_target_it;
+    }
+
+    ++b_it;
+  }
+
+  return true;
+}
+
+/// Writes the changes that turn \p base into \p symbol_table and
+/// \p goto_functions, using goto binary delta format
+/// \param out: stream to write to
+/// \param base_file_name: the name of the base to be stored in the delta
+/// \param base_hash: the \ref goto_binary_file_hash of the base
+/// \param base: the model read from the base
+/// \param symbol_table: the symbol table to write
+/// \param inserted: symbols of \p symbol_table not in the base
+/// \param updated: symbols of \p symbol_table that differ from the base
+/// \param removed: symbols of the base not in \p symbol_table
+/// \param goto_functions: the functions to write
+static bool write_goto_binary_delta(
+  std::ostream &out,
+  const std::string &base_file_name,
+  std::size_t base_hash,
+  const goto_modelt &base,
+  const symbol_tablet &symbol_table,
+  const journalling_symbol_tablet::changesett &inserted,
+  const journalling_symbol_tablet::changesett &updated,
+  const journalling_symbol_tablet::changesett &removed,
+  const goto_functionst &goto_functions)
+{
+  // header
+  out << char(0x7f) << "GBD";
+  write_gb_word(out, GOTO_BINARY_VERSION);
+  write_gb_string(out, base_file_name);
+
+  // allows the reader to notice that the base has been replaced
+  write_gb_word(out, base_hash);
+
+  irep_serializationt::ireps_containert irepc;
+  irep_serializationt irepconverter(irepc);
+
+  write_gb_word(out, removed.size());
+
+  for(const auto &id : removed)
+    irepconverter.write_string_ref(out, id);
+
+  write_gb_word(out, inserted.size() + updated.size());
+
+  for(const auto &id : inserted)
+  {
+    write_gb_word(out, 0);
+    write_symbol(out, symbol_table.lookup_ref(id), irepconverter);
+  }
+
+  for(const auto &id : updated)
+  {
+    write_gb_word(out, 1);
+    write_symbol(out, symbol_table.lookup_ref(id), irepconverter);
+  }
+
+  // now the function bodies that have gone or changed
+
+  std::vector<irep_idt> removed_bodies;
+
+  for(const auto &fct : base.goto_functions.function_map)
+  {
+    if(!fct.second.body_available())
+      continue;
+
+    const auto entry = goto_functions.function_map.find(fct.first);
+    if(
+      entry == goto_functions.function_map.end() ||
+      !entry->second.body_available())
+    {
+      removed_bodies.push_back(fct.first);
+    }
+  }
+
+  write_gb_word(out, removed_bodies.size());
+
+  for(const auto &id : removed_bodies)
+    irepconverter.write_string_ref(out, id);
+
+  std::vector<goto_functionst::function_mapt::const_iterator> changed_bodies;
+
+  for(auto it = goto_functions.function_map.begin();
+      it != goto_functions.function_map.end();
+      ++it)
+  {
+    if(!it->second.body_available())
+      continue;
+
+    const auto entry = base.goto_functions.function_map.find(it->first);
+    if(
+      entry == base.goto_functions.function_map.end() ||
+      !entry->second.body_available() ||
+      !same_body(entry->second.body, it->second.body))
+    {
+      changed_bodies.push_back(it);
+    }
+  }
+
+  write_gb_word(out, changed_bodies.size());
+
+  for(const auto &it : changed_bodies)
+    write_function_body(out, it->first, it->second.body, irepconverter);
+
+  return false;
+}
+
+/// Writes the difference between \p base and \p goto_model, using goto
+/// binary delta format
+static bool write_goto_binary_delta(
+  std::ostream &out,
+  const std::string &base_file_name,
+  std::size_t base_hash,
+  const goto_modelt &base,
+  const goto_modelt &goto_model)
+{
+  journalling_symbol_tablet::changesett inserted;
+  journalling_symbol_tablet::changesett updated;
+  journalling_symbol_tablet::changesett removed;
+
+  for(const auto &symbol_pair : goto_model.symbol_table.symbols)
+  {
+    const symbolt *base_symbol = base.symbol_table.lookup(symbol_pair.first);
+
+    if(base_symbol == nullptr)
+      inserted.insert(symbol_pair.first);
+    else if(!same_symbol(*base_symbol, symbol_pair.second))
+      updated.insert(symbol_pair.first);
+  }
+
+  for(const auto &symbol_pair : base.symbol_table.symbols)
+  {
+    if(!goto_model.symbol_table.has_symbol(symbol_pair.first))
+      removed.insert(symbol_pair.first);
+  }
+
+  return write_goto_binary_delta(
+    out,
+    base_file_name,
+    base_hash,
+    base,
+    goto_model.symbol_table,
+    inserted,
+    updated,
+    removed,
+    goto_model.goto_functions);
+}
+
+/// Writes the difference between \p base, which was read from
+/// \p base_file_name, and \p goto_model, using goto binary delta format
+bool write_goto_binary_delta(
+  std::ostream &out,
+  const std::string &base_file_name,
+  const goto_modelt &base,
+  const goto_modelt &goto_model)
+{
+  const auto base_hash = goto_binary_file_hash(base_file_name);
+  if(!base_hash.has_value())
+    return true;
+
+  return write_goto_binary_delta(
+    out, base_file_name, *base_hash, base, goto_model);
+}
+
+/// Writes the changes recorded in \p symbol_table, which wraps a copy of the
+/// symbol table of \p base, together with \p goto_functions, using goto
+/// binary delta format
+bool write_goto_binary_delta(
+  std::ostream &out,
+  const std::string &base_file_name,
+  const goto_modelt &base,
+  const journalling_symbol_tablet &symbol_table,
+  const goto_functionst &goto_functions)
+{
+  const auto base_hash = goto_binary_file_hash(base_file_name);
+  if(!base_hash.has_value())
+    return true;
+
+  // The journal marks inserted symbols as updated as well. Symbols that
+  // were inserted and then removed again are in neither set.
+  journalling_symbol_tablet::changesett updated;
+
+  for(const auto &id : symbol_table.get_updated())
+  {
+    if(symbol_table.get_inserted().count(id) == 0)
+      updated.insert(id);
+  }
+
+  return write_goto_binary_delta(
+    out,
+    base_file_name,
+    *base_hash,
+    base,
+    symbol_table.get_symbol_table(),
+    symbol_table.get_inserted(),
+    updated,
+    symbol_table.get_removed(),
+    goto_functions);
+}
+
+/// \return \p base_file_name as to be stored in a delta written to
+///   \p filename: relative names are resolved against the directory of the
+///   delta when it is read
+static std::string
+base_file_name_for_delta(const std::string &filename, const std::string &base)
+{
+  const std::size_t separator = filename.find_last_of("/\\");
+  if(separator == std::string::npos)
+    return base;
+
+  // the base is in the directory of the delta, or below it
+  const std::string directory = filename.substr(0, separator + 1);
+  if(has_prefix(base, directory))
+    return base.substr(directory.size());
+
+  // leaves absolute names unchanged
+  return concat_dir_file(get_current_working_directory(), base);
+}
+
+/// Writes the difference between \p base, which was read from
+/// \p base_file_name, and \p goto_model to the file \p filename
+bool write_goto_binary_delta(
+  const std::string &filename,
+  const std::string &base_file_name,
+  const goto_modelt &base,
+  const goto_modelt &goto_model,
+  message_handlert &message_handler)
+{
+  messaget message(message_handler);
+
+  const auto base_hash = goto_binary_file_hash(base_file_name);
+  if(!base_hash.has_value())
+  {
+    message.error() << "Failed to read '" << base_file_name << "'"
+                    << messaget::eom;
+    return true;
+  }
+
+  std::ofstream out(filename, std::ios::binary);
+
+  if(!out)
+  {
+    message.error() << "Failed to open '" << filename << "'" << messaget::eom;
+    return true;
+  }
+
+  return write_goto_binary_delta(
+    out,
+    base_file_name_for_delta(filename, base_file_name),
+    *base_hash,
+    base,
+    goto_model);
+}
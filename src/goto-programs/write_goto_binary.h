@@ -17,9 +17,12 @@ Author: CM Wintersteiger
 #include <iosfwd>
 #include <string>
 
+#include <util/optional.h>
+
 #include "goto_functions.h"
 
 class goto_modelt;
+class journalling_symbol_tablet;
 class message_handlert;
 
 bool write_goto_binary(
@@ -38,4 +41,34 @@ bool write_goto_binary(
   const goto_modelt &,
   message_handlert &);
 
+/// \return a hash of the contents of the file \p filename, which a goto
+///   binary delta records to recognise its base, or an empty optional if the
+///   file cannot be read
+optionalt<std::size_t> goto_binary_file_hash(const std::string &filename);
+
+/// A goto binary delta stores the name of a base goto binary together with
+/// the symbols and function bodies that have been inserted, updated or
+/// removed relative to it. A relative name of the base is resolved against
+/// the directory of the delta. Reading a delta reads the base and applies the
+/// changes, see \ref read_goto_binary.
+bool write_goto_binary_delta(
+  std::ostream &out,
+  const std::string &base_file_name,
+  const goto_modelt &base,
+  const goto_modelt &);
+
+bool write_goto_binary_delta(
+  std::ostream &out,
+  const std::string &base_file_name,
+  const goto_modelt &base,
+  const journalling_symbol_tablet &,
+  const goto_functionst &);
+
+bool write_goto_binary_delta(
+  const std::string &filename,
+  const std::string &base_file_name,
+  const goto_modelt &base,
+  const goto_modelt &,
+  message_handlert &);
+
 #endif // CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
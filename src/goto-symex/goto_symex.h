@@ -14,6 +14,11 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/options.h>
 #include <util/message.h>
+#include <util/optional.h>
+#include <util/std_code.h>
+
+#include <unordered_map>
+#include <unordered_set>
 
 #include <goto-programs/abstract_goto_model.h>
 
@@ -59,6 +64,10 @@ struct symex_configt final
 
   bool partial_loops;
 
+  /// \brief Should loops be summarised in closed form rather than unwound,
+  /// where possible? See \ref goto_symext::try_accelerate_loop.
+  bool accelerate_loops;
+
   mp_integer debug_level;
 
   /// \brief Should the additional validation checks be run?
@@ -445,6 +454,31 @@ protected:
 
   virtual void loop_bound_exceeded(statet &state, const exprt &guard);
 
+  /// Execute all iterations of the loop that is headed by the instruction
+  /// at `state.source.pc` at once, if the effect of the loop has a closed
+  /// form. This is the case for a loop whose body consists only of
+  /// assignments to distinct variables, each of which assigns either a
+  /// loop-invariant value or the variable plus a loop-invariant value, and
+  /// whose condition compares a counter that is stepped by one with a
+  /// loop-invariant bound.
+  /// \param state: Symbolic execution state, at the condition of a loop
+  /// \return true if the loop has been summarised, in which case
+  ///   \p state continues after the loop, and false if the loop is to be
+  ///   unwound
+  bool try_accelerate_loop(statet &state);
+
+  /// The assignments that summarise a loop, by loop id, or an empty optional
+  /// if the loop has no closed form. Summaries only depend on the code of
+  /// the loop and are reused whenever the loop is entered again.
+  std::unordered_map<irep_idt, optionalt<std::vector<code_assignt>>>
+    loop_summaries;
+
+  /// Ids of loops that have been unwound although acceleration was enabled
+  std::unordered_set<irep_idt> unwound_loops;
+
+  /// Output how many loops have been summarised and how many unwound
+  void output_loop_acceleration_statistics() const;
+
   /// Log a warning that a function has no body
   /// \param identifier: The name of the function with no body
   virtual void no_body(const irep_idt &identifier)
@@ -11,6 +11,7 @@ Author: Michael Tautschnig, michael.tautschnig@cs.ox.ac.uk
 
 #include "memory_model.h"
 
+#include <util/optional.h>
 #include <util/std_expr.h>
 
 memory_model_baset::memory_model_baset(const namespacet &_ns)
@@ -28,16 +29,36 @@ symbol_exprt memory_model_baset::nondet_bool_symbol(const std::string &prefix)
     "memory_model::choice_" + prefix + std::to_string(var_cnt++), bool_typet());
 }
 
+void memory_model_baset::build_spawn_events(
+  const symex_target_equationt &equation)
+{
+  spawn_events.clear();
+
+  unsigned next_thread_id = 0;
+  for(auto e_it = equation.SSA_steps.begin(); e_it != equation.SSA_steps.end();
+      ++e_it)
+  {
+    if(e_it->is_spawn())
+      spawn_events.emplace(++next_thread_id, e_it);
+  }
+}
+
 bool memory_model_baset::po(event_it e1, event_it e2)
 {
-  // within same thread
-  if(e1->source.thread_nr == e2->source.thread_nr)
-    return numbering[e1] < numbering[e2];
-  else
+  // In general events of different threads are un-ordered, with the
+  // exception of thread-spawning: walk up from the thread of e2 to the
+  // spawn in the thread of e1, if any. Threads are spawned by threads with
+  // smaller numbers only.
+  while(e1->source.thread_nr != e2->source.thread_nr)
   {
-    // in general un-ordered, with exception of thread-spawning
-    return false;
+    const auto spawn_it = spawn_events.find(e2->source.thread_nr);
+    if(spawn_it == spawn_events.end())
+      return false;
+
+    e2 = spawn_it->second;
   }
+
+  return numbering[e1] < numbering[e2];
 }
 
 void memory_model_baset::read_from(symex_target_equationt &equation)
@@ -45,11 +66,27 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
   // We iterate over all the reads, and
   // make them match at least one
   // (internal or external) write.
+  std::size_t pruned = 0;
 
   for(const auto &address : address_map)
   {
     for(const auto &read_event : address.second.reads)
     {
+      // The writes preceding the read in program order form a chain, as
+      // they are in the thread of the read or before the spawns of it and
+      // its ancestors. The last one that is certain to happen hides all
+      // writes before it.
+      optionalt<event_it> last_write;
+      for(const auto &write_event : address.second.writes)
+      {
+        if(
+          write_event->guard.is_true() && po(write_event, read_event) &&
+          (!last_write.has_value() || po(*last_write, write_event)))
+        {
+          last_write = write_event;
+        }
+      }
+
       exprt::operandst rf_choice_symbols;
       rf_choice_symbols.reserve(address.second.writes.size());
 
@@ -57,11 +94,16 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
       for(const auto &write_event : address.second.writes)
       {
         // rf cannot contradict program order
-        if(!po(read_event, write_event))
+        if(
+          po(read_event, write_event) ||
+          (last_write.has_value() && po(write_event, *last_write)))
         {
-          rf_choice_symbols.push_back(register_read_from_choice_symbol(
-            read_event, write_event, equation));
+          ++pruned;
+          continue;
         }
+
+        rf_choice_symbols.push_back(
+          register_read_from_choice_symbol(read_event, write_event, equation));
       }
 
       // uninitialised global symbol like symex_dynamic::dynamic_object*
@@ -78,6 +120,9 @@ void memory_model_baset::read_from(symex_target_equationt &equation)
       }
     }
   }
+
+  statistics() << "Read-from pairs: " << choice_symbols.size() << ", pruned "
+               << pruned << " by program order" << eom;
 }
 
 symbol_exprt memory_model_baset::register_read_from_choice_symbol(
@@ -23,12 +23,22 @@ public:
   virtual void operator()(symex_target_equationt &) = 0;
 
 protected:
-  /// In-thread program order
+  /// In-thread program order, extended across threads by thread spawning:
+  /// the events preceding a spawn precede all events of the spawned thread
+  /// and of the threads it spawns in turn
   /// \param e1: preceding event
   /// \param e2: following event
   /// \return true if e1 precedes e2 in program order
   bool po(event_it e1, event_it e2);
 
+  // the spawn event that created each thread other than thread 0
+  std::map<unsigned, event_it> spawn_events;
+
+  /// Populate \ref spawn_events, where the n-th spawn in \p equation
+  /// creates thread n
+  /// \param equation: symex equation to take the spawn events from
+  void build_spawn_events(const symex_target_equationt &equation);
+
   // produce fresh symbols
   unsigned var_cnt;
   symbol_exprt nondet_bool_symbol(const std::string &prefix);
@@ -41,6 +51,8 @@ protected:
   /// For each read `r` from every address we collect the choice symbols `S`
   ///   via \ref register_read_from_choice_symbol (for potential read-write
   ///   pairs) and add a constraint r.guard => \/S.
+  /// Writes that follow `r` in program order are not considered, and neither
+  ///   are writes preceding a write with guard 'true' that precedes `r`.
   /// \param equation: symex equation where the new constraint should be added
   void read_from(symex_target_equationt &equation);
 
@@ -18,6 +18,7 @@ void memory_model_sct::operator()(symex_target_equationt &equation)
   statistics() << "Adding SC constraints" << eom;
 
   build_event_lists(equation);
+  build_spawn_events(equation);
   build_clock_type();
 
   read_from(equation);
@@ -223,6 +224,13 @@ void memory_model_sct::write_serialization_external(
            (*w_it2)->source.thread_nr)
           continue;
 
+        // already ordered via thread spawning?
+        if((po(*w_it1, *w_it2) &&
+            !program_order_is_relaxed(*w_it1, *w_it2)) ||
+           (po(*w_it2, *w_it1) &&
+            !program_order_is_relaxed(*w_it2, *w_it1)))
+          continue;
+
         // ws is a total order, no two elements have the same rank
         // s -> w_evt1 before w_evt2; !s -> w_evt2 before w_evt1
 
@@ -249,6 +257,17 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
 {
   // from-read: (w', w) in ws and (w', r) in rf -> (r, w) in fr
 
+  // the read-from choice symbols per write
+  typedef std::map<event_it, std::vector<choice_symbolst::const_iterator>>
+    rf_per_writet;
+  rf_per_writet rf_per_write;
+
+  for(choice_symbolst::const_iterator
+      c_it=choice_symbols.begin();
+      c_it!=choice_symbols.end();
+      c_it++)
+    rf_per_write[c_it->first.second].push_back(c_it);
+
   for(address_mapt::const_iterator
       a_it=address_map.begin();
       a_it!=address_map.end();
@@ -262,6 +281,9 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
         w_prime!=a_rec.writes.end();
         ++w_prime)
     {
+      rf_per_writet::const_iterator rf_w_prime=
+        rf_per_write.find(*w_prime);
+
       event_listt::const_iterator next=w_prime;
       ++next;
 
@@ -269,6 +291,12 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
           w!=a_rec.writes.end();
           ++w)
       {
+        rf_per_writet::const_iterator rf_w=rf_per_write.find(*w);
+
+        // no reads from either write
+        if(rf_w_prime==rf_per_write.end() && rf_w==rf_per_write.end())
+          continue;
+
         exprt ws1, ws2;
 
         if(po(*w_prime, *w) &&
@@ -289,45 +317,46 @@ void memory_model_sct::from_read(symex_target_equationt &equation)
           ws2=before(*w, *w_prime);
         }
 
-        // smells like cubic
-        for(choice_symbolst::const_iterator
-            c_it=choice_symbols.begin();
-            c_it!=choice_symbols.end();
-            c_it++)
+        if(rf_w_prime!=rf_per_write.end() && !ws1.is_false())
         {
-          event_it r=c_it->first.first;
-          exprt rf=c_it->second;
-          exprt cond;
-          cond.make_nil();
-
-          if(c_it->first.second==*w_prime && !ws1.is_false())
+          for(const auto &c_it : rf_w_prime->second)
           {
+            event_it r=c_it->first.first;
+            exprt rf=c_it->second;
             exprt fr=before(r, *w);
 
             // the guard of w_prime follows from rf; with rfi
             // optimisation such as the previous write_symbol_primed
             // it would even be wrong to add this guard
-            cond=
+            add_constraint(
+              equation,
               implies_exprt(
                 and_exprt(r->guard, (*w)->guard, ws1, rf),
-                fr);
+                fr),
+              "fr",
+              r->source);
           }
-          else if(c_it->first.second==*w && !ws2.is_false())
+        }
+
+        if(rf_w!=rf_per_write.end() && !ws2.is_false())
+        {
+          for(const auto &c_it : rf_w->second)
           {
+            event_it r=c_it->first.first;
+            exprt rf=c_it->second;
             exprt fr=before(r, *w_prime);
 
             // the guard of w follows from rf; with rfi
             // optimisation such as the previous write_symbol_primed
             // it would even be wrong to add this guard
-            cond=
+            add_constraint(
+              equation,
               implies_exprt(
                 and_exprt(r->guard, (*w_prime)->guard, ws2, rf),
-                fr);
+                fr),
+              "fr",
+              r->source);
           }
-
-          if(cond.is_not_nil())
-            add_constraint(equation,
-              cond, "fr", r->source);
         }
       }
     }
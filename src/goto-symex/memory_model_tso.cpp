@@ -19,6 +19,7 @@ void memory_model_tsot::operator()(symex_target_equationt &equation)
   statistics() << "Adding TSO constraints" << eom;
 
   build_event_lists(equation);
+  build_spawn_events(equation);
   build_clock_type();
 
   read_from(equation);
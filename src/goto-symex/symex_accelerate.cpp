@@ -0,0 +1,263 @@
+/*******************************************************************\
+
+Module: Symbolic Execution of Loops in Closed Form
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Symbolic Execution of Loops in Closed Form
+
+#include "goto_symex.h"
+#include "goto_symex_state.h"
+
+#include <util/arith_tools.h>
+#include <util/expr_util.h>
+#include <util/std_expr.h>
+
+/// \return true if \p expr evaluates to the same value in all iterations of
+///   a loop that assigns the symbols in \p written
+static bool is_loop_invariant(
+  const exprt &expr,
+  const std::unordered_set<irep_idt> &written)
+{
+  return !has_subexpr(expr, [&written](const exprt &subexpr) {
+    return subexpr.id() == ID_side_effect || subexpr.id() == ID_dereference ||
+           (subexpr.id() == ID_symbol &&
+            written.count(to_symbol_expr(subexpr).get_identifier()) != 0);
+  });
+}
+
+static bool is_integer_type(const typet &type)
+{
+  return type.id() == ID_signedbv || type.id() == ID_unsignedbv;
+}
+
+/// Compute assignments that have the effect of all iterations of a loop
+/// \param head: The goto to the exit of the loop, which is its first
+///   instruction
+/// \param backedge: The goto back to \p head
+/// \return The assignments in the order they are to be executed, or an
+///   empty optional if the loop has no closed form we know of
+static optionalt<std::vector<code_assignt>> summarise_loop(
+  goto_programt::const_targett head,
+  goto_programt::const_targett backedge)
+{
+  std::vector<std::reference_wrapper<const code_assignt>> assignments;
+  std::unordered_set<irep_idt> written;
+
+  for(auto it = std::next(head); it != backedge; ++it)
+  {
+    if(it->is_assign())
+    {
+      const code_assignt &assignment = it->get_assign();
+      if(
+        assignment.lhs().id() != ID_symbol ||
+        !written.insert(to_symbol_expr(assignment.lhs()).get_identifier())
+           .second)
+      {
+        return {};
+      }
+      assignments.push_back(assignment);
+    }
+    else if(!it->is_skip() && !it->is_location())
+      return {};
+  }
+
+  // The loop is iterated for as long as the condition of the goto to its
+  // exit does not hold. We need it in the form 'counter < bound' or
+  // 'counter > bound'.
+  const exprt &exit_condition = head->get_condition();
+  irep_idt relation;
+  exprt counter, bound;
+
+  if(
+    exit_condition.id() == ID_not &&
+    (to_not_expr(exit_condition).op().id() == ID_lt ||
+     to_not_expr(exit_condition).op().id() == ID_gt))
+  {
+    const auto &condition =
+      to_binary_relation_expr(to_not_expr(exit_condition).op());
+    relation = condition.id();
+    counter = condition.lhs();
+    bound = condition.rhs();
+  }
+  else if(exit_condition.id() == ID_ge || exit_condition.id() == ID_le)
+  {
+    const auto &condition = to_binary_relation_expr(exit_condition);
+    relation = exit_condition.id() == ID_ge ? ID_lt : ID_gt;
+    counter = condition.lhs();
+    bound = condition.rhs();
+  }
+  else
+    return {};
+
+  if(
+    counter.id() != ID_symbol ||
+    written.count(to_symbol_expr(counter).get_identifier()) == 0)
+  {
+    std::swap(counter, bound);
+    relation = relation == ID_lt ? ID_gt : ID_lt;
+  }
+
+  if(
+    counter.id() != ID_symbol ||
+    written.count(to_symbol_expr(counter).get_identifier()) == 0 ||
+    !is_integer_type(counter.type()) || bound.type() != counter.type() ||
+    !is_loop_invariant(bound, written))
+  {
+    return {};
+  }
+
+  const binary_relation_exprt condition(counter, relation, bound);
+
+  // The number of iterations; the difference of counter and bound is exact
+  // in the unsigned type of the same width, as it is positive.
+  const unsignedbv_typet count_type(
+    to_bitvector_type(counter.type()).get_width());
+  const exprt count = if_exprt(
+    condition,
+    relation == ID_lt
+      ? minus_exprt(
+          typecast_exprt::conditional_cast(bound, count_type),
+          typecast_exprt::conditional_cast(counter, count_type))
+      : minus_exprt(
+          typecast_exprt::conditional_cast(counter, count_type),
+          typecast_exprt::conditional_cast(bound, count_type)),
+    from_integer(0, count_type));
+
+  std::vector<code_assignt> summary;
+  optionalt<code_assignt> counter_update;
+
+  for(const code_assignt &assignment : assignments)
+  {
+    const exprt &lhs = assignment.lhs();
+    const exprt &rhs = assignment.rhs();
+
+    if(is_loop_invariant(rhs, written))
+    {
+      // assigned the same value in each iteration
+      summary.emplace_back(
+        lhs,
+        if_exprt(notequal_exprt(count, from_integer(0, count_type)), rhs, lhs));
+      continue;
+    }
+
+    // Otherwise the assignment needs to add or subtract an invariant step.
+    if(
+      (rhs.id() != ID_plus && rhs.id() != ID_minus) ||
+      rhs.operands().size() != 2 || !is_integer_type(lhs.type()))
+    {
+      return {};
+    }
+
+    const bool subtract = rhs.id() == ID_minus;
+    exprt step;
+    if(to_binary_expr(rhs).op0() == lhs)
+      step = to_binary_expr(rhs).op1();
+    else if(!subtract && to_binary_expr(rhs).op1() == lhs)
+      step = to_binary_expr(rhs).op0();
+    else
+      return {};
+
+    if(step.type() != lhs.type() || !is_loop_invariant(step, written))
+      return {};
+
+    // Unsigned and signed arithmetic wraps around in the same way for
+    // k iterations and for a single one that adds k times the step.
+    const mult_exprt product(
+      typecast_exprt::conditional_cast(count, lhs.type()), step);
+    const exprt new_value = subtract ? exprt(minus_exprt(lhs, product))
+                                     : exprt(plus_exprt(lhs, product));
+
+    if(lhs != counter)
+    {
+      summary.emplace_back(lhs, new_value);
+      continue;
+    }
+
+    // The counter needs to be stepped by one towards the bound, as the
+    // count would be off otherwise.
+    if(!step.is_constant())
+      return {};
+
+    const auto step_value = numeric_cast<mp_integer>(step);
+    if(
+      !step_value.has_value() ||
+      (subtract ? -*step_value : *step_value) != (relation == ID_lt ? 1 : -1))
+    {
+      return {};
+    }
+
+    counter_update = code_assignt(lhs, new_value);
+  }
+
+  if(!counter_update.has_value())
+    return {};
+
+  // The count refers to the value of the counter before the loop.
+  summary.push_back(*counter_update);
+
+  return summary;
+}
+
+bool goto_symext::try_accelerate_loop(statet &state)
+{
+  // We only summarise loops that are entered at their condition, which
+  // is the shape while and for loops are converted to:
+  //   head:  IF !condition THEN GOTO exit
+  //          ...
+  //          GOTO head
+  //   exit:  ...
+  const goto_programt::const_targett head = state.source.pc;
+  if(head->is_backwards_goto() || head->targets.size() != 1)
+    return false;
+
+  const goto_programt::const_targett exit = head->get_target();
+  const goto_programt::const_targett backedge = std::prev(exit);
+  if(
+    backedge == head || !backedge->is_goto() ||
+    backedge->targets.size() != 1 || backedge->get_target() != head ||
+    !backedge->get_condition().is_true())
+  {
+    return false;
+  }
+
+  // other threads could observe the intermediate states of the loop
+  if(state.threads.size() != 1)
+    return false;
+
+  const irep_idt loop_id =
+    goto_programt::loop_id(state.source.function_id, *backedge);
+
+  auto summary_it = loop_summaries.find(loop_id);
+  if(summary_it == loop_summaries.end())
+  {
+    summary_it =
+      loop_summaries.emplace(loop_id, summarise_loop(head, backedge)).first;
+  }
+
+  if(!summary_it->second.has_value())
+    return false;
+
+  for(const auto &assignment : *summary_it->second)
+    symex_assign(state, assignment);
+
+  symex_transition(state, exit, false);
+  return true;
+}
+
+void goto_symext::output_loop_acceleration_statistics() const
+{
+  std::size_t summarised = 0;
+  for(const auto &loop_summary : loop_summaries)
+  {
+    if(loop_summary.second.has_value())
+      ++summarised;
+  }
+
+  log.statistics() << "Loops summarised: " << summarised
+                   << ", loops unwound: " << unwound_loops.size()
+                   << messaget::eom;
+}
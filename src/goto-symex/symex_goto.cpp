@@ -222,6 +222,9 @@ renamedt<exprt, L2> try_evaluate_pointer_comparisons(
 
 void goto_symext::symex_goto(statet &state)
 {
+  if(symex_config.accelerate_loops && try_accelerate_loop(state))
+    return;
+
   const goto_programt::instructiont &instruction=*state.source.pc;
 
   exprt new_guard = clean_expr(instruction.get_condition(), state, false);
@@ -280,6 +283,9 @@ void goto_symext::symex_goto(statet &state)
     const auto loop_id =
       goto_programt::loop_id(state.source.function_id, *state.source.pc);
 
+    if(symex_config.accelerate_loops)
+      unwound_loops.insert(loop_id);
+
     unsigned &unwind = state.call_stack().top().loop_iterations[loop_id].count;
     unwind++;
 
@@ -42,6 +42,7 @@ symex_configt::symex_configt(const optionst &options)
     simplify_opt(options.get_bool_option("simplify")),
     unwinding_assertions(options.get_bool_option("unwinding-assertions")),
     partial_loops(options.get_bool_option("partial-loops")),
+    accelerate_loops(options.get_bool_option("accelerate-loops")),
     debug_level(unsafe_string2int(options.get_option("debug-level"))),
     run_validation_checks(options.get_bool_option("validate-ssa-equation")),
     show_symex_steps(options.get_bool_option("show-goto-symex-steps"))
@@ -296,6 +297,9 @@ void goto_symext::symex_with_state(
       return;
   }
 
+  if(symex_config.accelerate_loops)
+    output_loop_acceleration_statistics();
+
   // Clients may need to construct a namespace with both the names in
   // the original goto-program and the names generated during symbolic
   // execution, so return the names generated through symbolic execution
@@ -419,6 +423,10 @@ goto_symext::print_callstack_entry(const symex_targett::sourcet &source)
   log.status() << source.function_id
                << " location number: " << source.pc->location_number;
 
+  const irep_idt &line = source.pc->source_location.get_line();
+  if(!line.empty())
+    log.status() << " line: " << line;
+
   return log.status();
 }
 
@@ -331,6 +331,19 @@ void symex_target_equationt::convert(decision_proceduret &decision_procedure)
   convert_constraints(decision_procedure);
 }
 
+void symex_target_equationt::convert_without_assertions(
+  decision_proceduret &decision_procedure)
+{
+  convert_guards(decision_procedure);
+  convert_assignments(decision_procedure);
+  convert_decls(decision_procedure);
+  convert_assumptions(decision_procedure);
+  convert_goto_instructions(decision_procedure);
+  convert_function_calls(decision_procedure);
+  convert_io(decision_procedure);
+  convert_constraints(decision_procedure);
+}
+
 void symex_target_equationt::convert_assignments(
   decision_proceduret &decision_procedure)
 {
@@ -450,6 +463,14 @@ void symex_target_equationt::convert_constraints(
 void symex_target_equationt::convert_assertions(
   decision_proceduret &decision_procedure)
 {
+  // ignore already converted assertions in the error trace, also when there
+  // are no new ones: revert_slice may have reset their flag
+  for(auto &step : SSA_steps)
+  {
+    if(step.is_assert() && step.converted)
+      step.ignore = true;
+  }
+
   // we find out if there is only _one_ assertion,
   // which allows for a simpler formula
 
@@ -462,10 +483,6 @@ void symex_target_equationt::convert_assertions(
   {
     for(auto &step : SSA_steps)
     {
-      // ignore already converted assertions in the error trace
-      if(step.is_assert() && step.converted)
-        step.ignore = true;
-
       if(step.is_assert() && !step.ignore && !step.converted)
       {
         step.converted = true;
@@ -474,7 +491,12 @@ void symex_target_equationt::convert_assertions(
         return; // prevent further assumptions!
       }
       else if(step.is_assume())
-        decision_procedure.set_to_true(step.cond_expr);
+      {
+        // the assumptions have been converted before; setting their handles
+        // rather than the conditions themselves keeps equalities from being
+        // propagated outside of the current solver context
+        decision_procedure.set_to_true(step.cond_handle);
+      }
     }
 
     UNREACHABLE; // unreachable
@@ -489,10 +511,6 @@ void symex_target_equationt::convert_assertions(
 
   for(auto &step : SSA_steps)
   {
-    // ignore already converted assertions in the error trace
-    if(step.is_assert() && step.converted)
-      step.ignore = true;
-
     if(step.is_assert() && !step.ignore && !step.converted)
     {
       step.converted = true;
@@ -531,7 +549,8 @@ void symex_target_equationt::convert_function_calls(
   decision_proceduret &dec_proc)
 {
   for(auto &step : SSA_steps)
-    if(!step.ignore)
+    // the arguments may have been converted by an earlier call already
+    if(!step.ignore && step.converted_function_arguments.empty())
     {
       step.converted_function_arguments.reserve(step.ssa_function_arguments.size());
 
@@ -559,7 +578,8 @@ void symex_target_equationt::convert_io(
   decision_proceduret &dec_proc)
 {
   for(auto &step : SSA_steps)
-    if(!step.ignore)
+    // the arguments may have been converted by an earlier call already
+    if(!step.ignore && step.converted_io_args.empty())
     {
       for(const auto &arg : step.io_args)
       {
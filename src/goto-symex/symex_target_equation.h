@@ -178,6 +178,13 @@ public:
   /// \param decision_procedure: A handle to a decision procedure interface
   void convert(decision_proceduret &decision_procedure);
 
+  /// Interface method to initiate the conversion into a decision procedure
+  /// format of all steps but the assertions, which incremental checkers
+  /// convert separately. Steps that have been converted by an earlier call
+  /// are not converted again.
+  /// \param decision_procedure: A handle to a decision procedure interface
+  void convert_without_assertions(decision_proceduret &decision_procedure);
+
   /// Converts assignments: set the equality _lhs==rhs_ to _True_.
   /// \param decision_procedure: A handle to a decision procedure
   ///  interface
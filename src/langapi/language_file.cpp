@@ -275,6 +275,12 @@ bool language_filest::typecheck_module(
   if(!module.in_progress)
     return true;
 
+  // register lazy methods
+  std::unordered_set<irep_idt> lazy_method_ids;
+  module.file->language->methods_provided(lazy_method_ids);
+  for(const auto &id : lazy_method_ids)
+    lazy_method_map[id]=module.file;
+
   module.type_checked=true;
   module.in_progress=false;
 
@@ -1395,16 +1395,9 @@ void linkingt::copy_symbols()
   }
 }
 
-void linkingt::typecheck()
+void linkingt::find_symbols_to_rename(
+  std::unordered_set<irep_idt> &needs_to_be_renamed)
 {
-  // We do this in three phases. We first figure out which symbols need to
-  // be renamed, and then build the renaming, and finally apply this
-  // renaming in the second pass over the symbol table.
-
-  // PHASE 1: identify symbols to be renamed
-
-  std::unordered_set<irep_idt> needs_to_be_renamed;
-
   for(const auto &symbol_pair : src_symbol_table.symbols)
   {
     symbol_tablet::symbolst::const_iterator m_it =
@@ -1420,6 +1413,25 @@ void linkingt::typecheck()
       #endif
     }
   }
+}
+
+bool linkingt::renames_symbols()
+{
+  std::unordered_set<irep_idt> needs_to_be_renamed;
+  find_symbols_to_rename(needs_to_be_renamed);
+  return !needs_to_be_renamed.empty();
+}
+
+void linkingt::typecheck()
+{
+  // We do this in three phases. We first figure out which symbols need to
+  // be renamed, and then build the renaming, and finally apply this
+  // renaming in the second pass over the symbol table.
+
+  // PHASE 1: identify symbols to be renamed
+
+  std::unordered_set<irep_idt> needs_to_be_renamed;
+  find_symbols_to_rename(needs_to_be_renamed);
 
   // renaming types may trigger further renaming
   do_type_dependencies(needs_to_be_renamed);
@@ -1441,3 +1453,14 @@ bool linking(
 
   return linking.typecheck_main();
 }
+
+bool linking_renames_symbols(
+  symbol_tablet &dest_symbol_table,
+  symbol_tablet &new_symbol_table,
+  message_handlert &message_handler)
+{
+  linkingt linking(
+    dest_symbol_table, new_symbol_table, message_handler);
+
+  return linking.renames_symbols();
+}
@@ -24,4 +24,12 @@ bool linking(
   symbol_tablet &new_symbol_table,
   message_handlert &message_handler);
 
+/// \return true if linking \p new_symbol_table into \p dest_symbol_table
+///   would rename symbols of \p new_symbol_table, such as clashing struct
+///   tags or file-local symbols
+bool linking_renames_symbols(
+  symbol_tablet &dest_symbol_table,
+  symbol_tablet &new_symbol_table,
+  message_handlert &message_handler);
+
 #endif // CPROVER_LINKING_LINKING_H
@@ -40,6 +40,10 @@ public:
 
   virtual void typecheck();
 
+  /// \return true if linking would rename any symbol of the source symbol
+  ///   table
+  bool renames_symbols();
+
   rename_symbolt rename_symbol;
   casting_replace_symbolt object_type_updates;
 
@@ -62,6 +66,9 @@ protected:
       return needs_renaming_non_type(old_symbol, new_symbol);
   }
 
+  void find_symbols_to_rename(
+    std::unordered_set<irep_idt> &needs_to_be_renamed);
+
   void do_type_dependencies(std::unordered_set<irep_idt> &);
 
   void rename_symbols(const std::unordered_set<irep_idt> &needs_to_be_renamed);
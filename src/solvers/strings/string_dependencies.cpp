@@ -130,6 +130,8 @@ void string_dependenciest::clear()
   builtin_function_nodes.clear();
   string_nodes.clear();
   node_index_pool.clear();
+  constrained_nodes.clear();
+  length_constrained_nodes.clear();
   clean_cache();
 }
 
@@ -368,11 +370,17 @@ string_dependenciest::add_constraints(string_constraint_generatort &generator)
   {
     if(test_dependencies.count(nodet(node)))
     {
+      if(!constrained_nodes.insert(node.index).second)
+        continue;
       const auto &builtin = builtin_function_nodes[node.index];
       merge(constraints, builtin.data->constraints(generator));
     }
-    else
+    else if(
+      !constrained_nodes.count(node.index) &&
+      length_constrained_nodes.insert(node.index).second)
+    {
       constraints.existential.push_back(node.data->length_constraint());
+    }
   }
   return constraints;
 }
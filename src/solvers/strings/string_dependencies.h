@@ -13,6 +13,7 @@ Author: Diffblue Ltd.
 #define CPROVER_SOLVERS_STRINGS_STRING_DEPENDENCIES_H
 
 #include <memory>
+#include <unordered_set>
 
 #include <util/nodiscard.h>
 
@@ -115,6 +116,8 @@ public:
   /// For all builtin call on which a test (or an unsupported buitin)
   /// result depends, add the corresponding constraints. For the other builtin
   /// only add constraints on the length.
+  /// Constraints returned by earlier calls are not returned again, so that
+  /// incremental calls to the solver only receive the new ones.
   NODISCARD string_constraintst
   add_constraints(string_constraint_generatort &generatort);
 
@@ -133,6 +136,14 @@ private:
   std::unordered_map<array_string_exprt, std::size_t, irep_hash>
     node_index_pool;
 
+  /// Indices of the builtin function nodes whose constraints have already
+  /// been returned by `add_constraints`
+  std::unordered_set<std::size_t> constrained_nodes;
+
+  /// Indices of the builtin function nodes for which only the length
+  /// constraint has been returned by `add_constraints`
+  std::unordered_set<std::size_t> length_constrained_nodes;
+
   class nodet
   {
   public:
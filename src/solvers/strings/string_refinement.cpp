@@ -605,6 +605,8 @@ output_equations(std::ostream &output, const std::vector<exprt> &equations)
 ///   `resultt::D_ERROR` if the limit of iteration was reached.
 decision_proceduret::resultt string_refinementt::dec_solve()
 {
+  duplicate_lemmas = 0;
+
 #ifdef DEBUG
   log.debug() << "dec_solve: Initial set of equations" << messaget::eom;
   output_equations(log.debug(), equations);
@@ -702,8 +704,13 @@ decision_proceduret::resultt string_refinementt::dec_solve()
   dependencies.output_dot(log.debug());
 #endif
 
+  // Only the constraints of builtin functions added since the previous call
+  // are returned, the other ones are already part of `axioms` and of the
+  // underlying solver
   log.debug() << "dec_solve: add constraints" << messaget::eom;
   merge(constraints, dependencies.add_constraints(generator));
+  const std::size_t reused_universal = axioms.universal.size();
+  const std::size_t reused_not_contains = axioms.not_contains.size();
 
 #ifdef DEBUG
   output_equations(log.debug(), equations);
@@ -749,11 +756,14 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       return axiom;
     });
 
-  // Used to store information about witnesses for not_contains constraints
-  std::unordered_map<string_not_contains_constraintt, symbol_exprt>
-    not_contain_witnesses;
-  for(const auto &nc_axiom : axioms.not_contains)
+  // Witnesses of the axioms from earlier calls are kept
+  for(auto it = axioms.not_contains.begin() + reused_not_contains;
+      it != axioms.not_contains.end();
+      ++it)
   {
+    const string_not_contains_constraintt &nc_axiom = *it;
+    if(not_contain_witnesses.count(nc_axiom))
+      continue;
     const auto &witness_type = [&] {
       const auto &rtype = to_array_type(nc_axiom.s0.type());
       const typet &index_type = rtype.size().type();
@@ -776,6 +786,14 @@ decision_proceduret::resultt string_refinementt::dec_solve()
       binary_relation_exprt{length, ID_ge, from_integer(0, length.type())});
   }
 
+  log.statistics() << "dec_solve: "
+                   << axioms.universal.size() - reused_universal +
+                        axioms.not_contains.size() - reused_not_contains
+                   << " new axioms, "
+                   << reused_universal + reused_not_contains
+                   << " axioms and " << index_sets.cumulative.size()
+                   << " index sets reused from earlier calls" << messaget::eom;
+
   // Initial try without index set
   const auto get = [this](const exprt &expr) { return this->get(expr); };
   dependencies.clean_cache();
@@ -807,7 +825,21 @@ decision_proceduret::resultt string_refinementt::dec_solve()
     return initial_result;
   }
 
-  initial_index_set(index_sets, ns, axioms);
+  // The axioms whose initial index set has been computed by an earlier call
+  // have already been instantiated with the indices found so far, so only
+  // the indices of the other axioms and of the lemmas added since are needed
+  // for them
+  string_axiomst new_axioms;
+  new_axioms.universal.assign(
+    axioms.universal.begin() + indexed_universal, axioms.universal.end());
+  new_axioms.not_contains.assign(
+    axioms.not_contains.begin() + indexed_not_contains,
+    axioms.not_contains.end());
+  const bool has_earlier_indices = !index_sets.cumulative.empty();
+  index_sets.current.clear();
+  initial_index_set(index_sets, ns, new_axioms);
+  indexed_universal = axioms.universal.size();
+  indexed_not_contains = axioms.not_contains.size();
   update_index_set(index_sets, ns, current_constraints);
   current_constraints.clear();
   const auto initial_instances =
@@ -817,6 +849,21 @@ decision_proceduret::resultt string_refinementt::dec_solve()
     add_lemma(substitute_array_access(instance, generator.fresh_symbol, true));
   }
 
+  // The new axioms also need to be instantiated with the earlier indices
+  if(has_earlier_indices)
+  {
+    const index_set_pairt all_indices{index_sets.cumulative,
+                                      index_sets.cumulative};
+    const auto instances =
+      generate_instantiations(all_indices, new_axioms, not_contain_witnesses);
+    for(const auto &instance : instances)
+      add_lemma(
+        substitute_array_access(instance, generator.fresh_symbol, true));
+  }
+  log.statistics() << "dec_solve: " << duplicate_lemmas
+                   << " lemmas already given to the solver were skipped"
+                   << messaget::eom;
+
   while((loop_bound_--) > 0)
   {
     dependencies.clean_cache();
@@ -897,7 +944,10 @@ void string_refinementt::add_lemma(
   const bool simplify_lemma)
 {
   if(!seen_instances.insert(lemma).second)
+  {
+    ++duplicate_lemmas;
     return;
+  }
 
   current_constraints.push_back(lemma);
 
@@ -100,8 +100,23 @@ private:
   // Simple constraints that have been given to the solver
   std::set<exprt> seen_instances;
 
+  // Number of lemmas not given to the solver by the current call to dec_solve
+  // because an earlier one already did
+  std::size_t duplicate_lemmas = 0;
+
   string_axiomst axioms;
 
+  // Number of leading axioms of `axioms.universal` and `axioms.not_contains`
+  // whose initial index set has been computed. A call to dec_solve which
+  // returns before computing it leaves its axioms to the next call.
+  std::size_t indexed_universal = 0;
+  std::size_t indexed_not_contains = 0;
+
+  // Witnesses for the not_contains axioms, kept between calls to dec_solve
+  // like the axioms themselves
+  std::unordered_map<string_not_contains_constraintt, symbol_exprt>
+    not_contain_witnesses;
+
   // Unquantified lemmas that have newly been added
   std::vector<exprt> current_constraints;
 
@@ -12,7 +12,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_UTIL_PARSER_H
 #define CPROVER_UTIL_PARSER_H
 
-#include <iosfwd>
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -46,8 +46,17 @@ public:
 
   bool read(char &ch)
   {
-    if(!in->read(&ch, 1))
+    // Go to the stream buffer directly: istream::read constructs a sentry
+    // and updates the stream state for every single character, which
+    // dominates scanning time on large preprocessed inputs.
+    const auto c = in->rdbuf()->sbumpc();
+    if(c == std::char_traits<char>::eof())
+    {
+      in->setstate(std::ios::eofbit | std::ios::failbit);
       return false;
+    }
+
+    ch = std::char_traits<char>::to_char_type(c);
 
     if(ch=='\n')
     {
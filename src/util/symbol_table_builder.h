@@ -6,6 +6,9 @@
 #ifndef CPROVER_UTIL_SYMBOL_TABLE_BUILDER_H
 #define CPROVER_UTIL_SYMBOL_TABLE_BUILDER_H
 
+#include <string>
+#include <unordered_map>
+
 #include "symbol_table_base.h"
 
 /// Wrapper around a symbol table that keeps track of suffixes for faster
@@ -14,7 +17,10 @@ class symbol_table_buildert : public symbol_table_baset
 {
 private:
   symbol_table_baset &base_symbol_table;
-  mutable std::map<std::string, std::size_t> next_free_suffix_for_prefix;
+  // Each function being converted contributes its own set of prefixes, so
+  // this grows with the size of the program: use a hash table.
+  mutable std::unordered_map<std::string, std::size_t>
+    next_free_suffix_for_prefix;
 
 public:
   explicit symbol_table_buildert(symbol_table_baset &base_symbol_table)
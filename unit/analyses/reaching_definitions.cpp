@@ -0,0 +1,79 @@
+/*******************************************************************\
+
+Module: Unit test for reaching_definitions.h
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <analyses/reaching_definitions.h>
+
+static std::vector<std::size_t> to_vector(const rd_id_sett &ids)
+{
+  return std::vector<std::size_t>(ids.begin(), ids.end());
+}
+
+SCENARIO("rd_id_sett", "[core][analyses][reaching_definitions]")
+{
+  GIVEN("A set of IDs spanning several chunks")
+  {
+    copy_on_writet<rd_id_sett> ids;
+    const std::size_t far = 3 * rd_id_sett::chunk_bits + 5;
+
+    REQUIRE(ids.read().empty());
+    REQUIRE(ids.write(true).insert(far));
+    REQUIRE(ids.write(true).insert(1));
+    REQUIRE(ids.write(true).insert(rd_id_sett::word_bits));
+    REQUIRE_FALSE(ids.write(true).insert(1));
+
+    THEN("The IDs are iterated over in ascending order")
+    {
+      REQUIRE(
+        to_vector(ids.read()) ==
+        std::vector<std::size_t>{1, rd_id_sett::word_bits, far});
+      REQUIRE(ids.read().contains(far));
+      REQUIRE_FALSE(ids.read().contains(far + 1));
+    }
+
+    WHEN("Erasing the only ID of a chunk")
+    {
+      ids.write(true).erase(far);
+
+      THEN("The ID is gone")
+      {
+        REQUIRE(
+          to_vector(ids.read()) ==
+          std::vector<std::size_t>{1, rd_id_sett::word_bits});
+      }
+    }
+
+    WHEN("Merging another set into a copy")
+    {
+      copy_on_writet<rd_id_sett> other;
+      other.write(true).insert(2);
+      other.write(true).insert(2 * rd_id_sett::chunk_bits);
+
+      copy_on_writet<rd_id_sett> merged = ids;
+      REQUIRE(merged == ids);
+      REQUIRE_FALSE(merged.read().includes(other.read()));
+
+      merged.write(true).merge(other.read());
+
+      THEN("The copy holds the union and the original is unchanged")
+      {
+        REQUIRE(merged != ids);
+        REQUIRE(merged.read().includes(other.read()));
+        REQUIRE(merged.read().includes(ids.read()));
+        REQUIRE(
+          to_vector(merged.read()) ==
+          std::vector<std::size_t>{
+            1, 2, rd_id_sett::word_bits, 2 * rd_id_sett::chunk_bits, far});
+        REQUIRE(
+          to_vector(ids.read()) ==
+          std::vector<std::size_t>{1, rd_id_sett::word_bits, far});
+      }
+    }
+  }
+}
@@ -0,0 +1,176 @@
+/*******************************************************************\
+
+Module: Unit test for sparse_dependence_graph.h
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/call_graph_test_utils.h>
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/c_types.h>
+#include <util/std_code.h>
+#include <util/symbol_table.h>
+
+#include <analyses/dependence_graph.h>
+#include <analyses/sparse_dependence_graph.h>
+#include <ansi-c/ansi_c_language.h>
+#include <goto-programs/goto_convert_functions.h>
+#include <langapi/mode.h>
+
+static symbolt make_local(const std::string &base_name, const typet &type)
+{
+  symbolt symbol;
+  symbol.name = id2string(goto_functionst::entry_point()) + "::" + base_name;
+  symbol.base_name = base_name;
+  symbol.type = type;
+  symbol.is_lvalue = true;
+  symbol.is_state_var = true;
+  symbol.is_thread_local = true;
+  symbol.is_file_local = true;
+  return symbol;
+}
+
+SCENARIO("sparse_dependence_graph", "[core][analyses][dependence_graph]")
+{
+  GIVEN("Definitions under a control dependency")
+  {
+    // Create code like:
+    // void __CPROVER__start() {
+    //   int x;
+    //   int y;
+    //   x = 0;
+    //   if(NONDET(int) == 0) {
+    //     b();
+    //     x = 1;
+    //   }
+    //   y = x;
+    // }
+    // void b() { }
+
+    register_language(new_ansi_c_language);
+
+    goto_modelt goto_model;
+    namespacet ns(goto_model.symbol_table);
+
+    typet int_type = signed_int_type();
+
+    const symbolt x_symbol = make_local("x", int_type);
+    const symbolt y_symbol = make_local("y", int_type);
+    goto_model.symbol_table.add(x_symbol);
+    goto_model.symbol_table.add(y_symbol);
+
+    const code_typet void_function_type({}, empty_typet());
+
+    code_blockt a_body({code_declt(x_symbol.symbol_expr()),
+                        code_declt(y_symbol.symbol_expr()),
+                        code_assignt(
+                          x_symbol.symbol_expr(), from_integer(0, int_type))});
+
+    code_function_callt call(symbol_exprt("b", void_function_type));
+    code_assignt assign_x(x_symbol.symbol_expr(), from_integer(1, int_type));
+
+    code_ifthenelset if_block(
+      equal_exprt(
+        side_effect_expr_nondett(int_type, source_locationt{}),
+        from_integer(0, int_type)),
+      code_blockt({call, assign_x}));
+
+    a_body.add(std::move(if_block));
+    a_body.add(code_assignt(y_symbol.symbol_expr(), x_symbol.symbol_expr()));
+
+    goto_model.symbol_table.add(
+      create_void_function_symbol(goto_functionst::entry_point(), a_body));
+    goto_model.symbol_table.add(
+      create_void_function_symbol("b", code_skipt()));
+
+    goto_convert(goto_model, null_message_handler);
+
+    WHEN("Constructing a sparse dependence graph")
+    {
+      sparse_dependence_grapht dep_graph(ns);
+      dep_graph(goto_model.goto_functions);
+
+      THEN("Every instruction has a node")
+      {
+        forall_goto_functions(f_it, goto_model.goto_functions)
+        {
+          forall_goto_program_instructions(i_it, f_it->second.body)
+          {
+            const auto node_id = dep_graph.get_node_id(i_it);
+            REQUIRE(node_id < dep_graph.size());
+            REQUIRE(dep_graph[node_id].PC == i_it);
+          }
+        }
+      }
+
+      THEN("The function call and the assignment under the condition "
+           "should have a control dependency")
+      {
+        for(std::size_t node_idx = 0; node_idx < dep_graph.size(); ++node_idx)
+        {
+          const dep_nodet &node = dep_graph[node_idx];
+          if(
+            node.PC->is_function_call() ||
+            (node.PC->is_assign() &&
+             node.PC->get_assign().rhs() == from_integer(1, int_type)))
+          {
+            REQUIRE(node.in.size() == 1);
+            REQUIRE(node.in.begin()->second.get() == dep_edget::kindt::CTRL);
+            REQUIRE(dep_graph[node.in.begin()->first].PC->is_goto());
+          }
+        }
+      }
+
+      THEN("The final assignment should depend on both definitions of x")
+      {
+        for(std::size_t node_idx = 0; node_idx < dep_graph.size(); ++node_idx)
+        {
+          const dep_nodet &node = dep_graph[node_idx];
+          if(
+            node.PC->is_assign() &&
+            node.PC->get_assign().lhs() == y_symbol.symbol_expr())
+          {
+            REQUIRE(node.in.size() == 2);
+
+            for(const auto &dep_edge : node.in)
+            {
+              REQUIRE(dep_edge.second.get() == dep_edget::kindt::DATA);
+              const goto_programt::const_targett def =
+                dep_graph[dep_edge.first].PC;
+              REQUIRE(def->is_assign());
+              REQUIRE(def->get_assign().lhs() == x_symbol.symbol_expr());
+            }
+          }
+        }
+      }
+
+      THEN("The graph should contain the dependencies computed by abstract "
+           "interpretation")
+      {
+        dependence_grapht ai_dep_graph(ns);
+        ai_dep_graph(goto_model.goto_functions, ns);
+
+        for(std::size_t node_idx = 0; node_idx < ai_dep_graph.size();
+            ++node_idx)
+        {
+          const dep_nodet &ai_node = ai_dep_graph[node_idx];
+          const dep_nodet &node =
+            dep_graph[dep_graph.get_node_id(ai_node.PC)];
+
+          for(const auto &ai_dep_edge : ai_node.in)
+          {
+            const auto from =
+              dep_graph.get_node_id(ai_dep_graph[ai_dep_edge.first].PC);
+            const auto edge = node.in.find(from);
+            REQUIRE(edge != node.in.end());
+            REQUIRE(edge->second.get() == ai_dep_edge.second.get());
+          }
+        }
+      }
+    }
+  }
+}
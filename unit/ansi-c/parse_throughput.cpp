@@ -0,0 +1,137 @@
+/*******************************************************************\
+
+Module: Unit tests for the ANSI-C parser on large translation units
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for the ANSI-C parser on large translation units
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <ansi-c/ansi_c_parser.h>
+
+#include <chrono>
+#include <sstream>
+
+/// Generate a preprocessed translation unit with \p n_functions function
+/// definitions, each preceded by a global variable declaration.
+static std::string generate_translation_unit(std::size_t n_functions)
+{
+  std::ostringstream out;
+  out << "typedef int word_t;\n";
+  out << "int f0(word_t a, word_t b) { return a; }\n";
+
+  for(std::size_t i = 1; i < n_functions; ++i)
+  {
+    out << "# " << i << " \"generated.c\"\n";
+    out << "word_t global" << i << " = " << i << ";\n";
+    out << "int f" << i << "(word_t a, word_t b)\n"
+        << "{\n"
+        << "  word_t x = a + b * " << i << ";\n"
+        << "  if(x > global" << i << ")\n"
+        << "    return x;\n"
+        << "  return f" << i - 1 << "(x, b);\n"
+        << "}\n";
+  }
+
+  return out.str();
+}
+
+/// Parse \p code using the global ANSI-C parser.
+/// \return true on error
+static bool parse_translation_unit(const std::string &code)
+{
+  std::istringstream in(code);
+
+  ansi_c_parser.clear();
+  ansi_c_parser.set_file("generated.c");
+  ansi_c_parser.in = &in;
+  ansi_c_parser.set_message_handler(null_message_handler);
+  ansi_c_parser.mode = ansi_c_parsert::modet::GCC;
+  ansi_c_parser.cpp98 = false;
+  ansi_c_parser.cpp11 = false;
+  ansi_c_scanner_init();
+
+  return ansi_c_parser.parse();
+}
+
+/// Modify \p irep in place.
+/// \return true if this does not copy its node, i.e. neither the parser nor
+///   another part of the parse tree holds a reference to it
+static bool is_unshared(irept &irep)
+{
+  const auto *before = &irep.read();
+  // forces a copy if there is another reference
+  irep.id(irep.id());
+  return &irep.read() == before;
+}
+
+SCENARIO(
+  "ansi_c_parsert moves top-level declarations into the parse tree",
+  "[core][ansi-c][ansi_c_parser]")
+{
+  GIVEN("A generated translation unit with 100 function definitions")
+  {
+    const std::string code = generate_translation_unit(100);
+
+    WHEN("It is parsed")
+    {
+      const bool failed = parse_translation_unit(code);
+
+      THEN("All declarations end up in the parse tree")
+      {
+        REQUIRE_FALSE(failed);
+        // typedef, f0, then a global and a function for each further index
+        REQUIRE(ansi_c_parser.parse_tree.items.size() == 2 + 2 * 99);
+        const ansi_c_declarationt &last =
+          ansi_c_parser.parse_tree.items.back();
+        REQUIRE(last.declarators().size() == 1);
+        REQUIRE(last.declarator().get_base_name() == "f99");
+      }
+
+      THEN("Declarations can be modified without unsharing")
+      {
+        REQUIRE_FALSE(failed);
+        for(auto &item : ansi_c_parser.parse_tree.items)
+        {
+          REQUIRE(is_unshared(item));
+          REQUIRE(is_unshared(item.type()));
+
+          for(auto &declarator : item.declarators())
+          {
+            REQUIRE(is_unshared(declarator));
+            // all nil subtrees refer to the same node
+            if(declarator.type().is_not_nil())
+              REQUIRE(is_unshared(declarator.type()));
+            if(declarator.value().is_not_nil())
+              REQUIRE(is_unshared(declarator.value()));
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO(
+  "ansi_c_parsert throughput on a large translation unit",
+  "[.][benchmark][ansi-c][ansi_c_parser]")
+{
+  const std::size_t n_functions = 20000;
+  const std::string code = generate_translation_unit(n_functions);
+
+  const auto start = std::chrono::steady_clock::now();
+  const bool failed = parse_translation_unit(code);
+  const std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  REQUIRE_FALSE(failed);
+  REQUIRE(ansi_c_parser.parse_tree.items.size() == 2 * n_functions);
+
+  WARN(
+    "parsed " << code.size() << " bytes (" << n_functions
+              << " functions) in " << elapsed.count() << "s");
+}
@@ -0,0 +1,177 @@
+/*******************************************************************\
+
+Module: Unit tests for goto binary deltas
+
+Author: Diffblue Ltd.
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <goto-programs/goto_model.h>
+#include <goto-programs/read_goto_binary.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include <util/arith_tools.h>
+#include <util/journalling_symbol_table.h>
+#include <util/std_types.h>
+#include <util/tempfile.h>
+
+#include <fstream>
+
+static symbolt make_variable(const irep_idt &name, int value)
+{
+  symbolt symbol;
+  symbol.name = name;
+  symbol.base_name = name;
+  symbol.pretty_name = name;
+  symbol.mode = ID_C;
+  symbol.type = signedbv_typet(32);
+  symbol.value = from_integer(value, symbol.type);
+  symbol.is_lvalue = true;
+  symbol.is_static_lifetime = true;
+  return symbol;
+}
+
+/// A model with variables x and y and a function f that assigns to x
+static void make_model(goto_modelt &goto_model)
+{
+  goto_model.symbol_table.add(make_variable("x", 1));
+  goto_model.symbol_table.add(make_variable("y", 1));
+
+  symbolt function;
+  function.name = "f";
+  function.base_name = "f";
+  function.pretty_name = "f";
+  function.mode = ID_C;
+  function.type = code_typet({}, empty_typet());
+  goto_model.symbol_table.add(function);
+
+  goto_functionst::goto_functiont &f =
+    goto_model.goto_functions.function_map["f"];
+  f.type = to_code_type(function.type);
+  const symbol_exprt x("x", signedbv_typet(32));
+  f.body.add(goto_programt::make_assignment(x, from_integer(2, x.type())));
+  f.body.add(goto_programt::make_end_function());
+  goto_model.goto_functions.update();
+}
+
+/// Change the model built by \ref make_model: update x, remove y, add z and
+/// extend the body of f
+static void change_model(symbol_table_baset &symbol_table, goto_modelt &model)
+{
+  symbol_table.get_writeable_ref("x").value =
+    from_integer(3, signedbv_typet(32));
+  symbol_table.remove("y");
+  symbol_table.insert(make_variable("z", 4));
+
+  goto_programt &body = model.goto_functions.function_map["f"].body;
+  body.insert_before(body.instructions.begin(), goto_programt::make_skip());
+  model.goto_functions.update();
+}
+
+static void require_changed_model(const goto_modelt &goto_model)
+{
+  const symbol_tablet &symbol_table = goto_model.symbol_table;
+  REQUIRE(
+    symbol_table.lookup_ref("x").value == from_integer(3, signedbv_typet(32)));
+  REQUIRE_FALSE(symbol_table.has_symbol("y"));
+  REQUIRE(symbol_table.has_symbol("z"));
+  REQUIRE(symbol_table.has_symbol("f"));
+
+  const auto &f = goto_model.goto_functions.function_map.at("f");
+  REQUIRE(f.body.instructions.size() == 3);
+  REQUIRE(f.body.instructions.front().is_skip());
+}
+
+SCENARIO(
+  "Goto binary deltas are applied to their base",
+  "[core][goto-programs][write_goto_binary]")
+{
+  temporary_filet base_file("goto_binary_delta_base", ".gb");
+  temporary_filet delta_file("goto_binary_delta", ".gb");
+
+  goto_modelt base;
+  make_model(base);
+  REQUIRE_FALSE(write_goto_binary(base_file(), base, null_message_handler));
+
+  GIVEN("A delta computed by comparing two models")
+  {
+    goto_modelt model;
+    make_model(model);
+    change_model(model.symbol_table, model);
+
+    REQUIRE_FALSE(write_goto_binary_delta(
+      delta_file(), base_file(), base, model, null_message_handler));
+
+    WHEN("The delta is read")
+    {
+      const auto result = read_goto_binary(delta_file(), null_message_handler);
+
+      THEN("The result is the changed model")
+      {
+        REQUIRE(is_goto_binary(delta_file(), null_message_handler));
+        REQUIRE(result.has_value());
+        require_changed_model(*result);
+      }
+    }
+
+    WHEN("The base has been replaced since")
+    {
+      goto_modelt other_base;
+      make_model(other_base);
+      other_base.symbol_table.add(make_variable("w", 0));
+      REQUIRE_FALSE(
+        write_goto_binary(base_file(), other_base, null_message_handler));
+
+      THEN("The delta is rejected")
+      {
+        REQUIRE_FALSE(
+          read_goto_binary(delta_file(), null_message_handler).has_value());
+      }
+    }
+
+    WHEN("The base has been replaced by one with as many symbols and bodies")
+    {
+      goto_modelt other_base;
+      make_model(other_base);
+      other_base.symbol_table.get_writeable_ref("y").value =
+        from_integer(5, signedbv_typet(32));
+      REQUIRE_FALSE(
+        write_goto_binary(base_file(), other_base, null_message_handler));
+
+      THEN("The delta is rejected")
+      {
+        REQUIRE_FALSE(
+          read_goto_binary(delta_file(), null_message_handler).has_value());
+      }
+    }
+  }
+
+  GIVEN("A delta written from a journal of the changes")
+  {
+    goto_modelt model;
+    make_model(model);
+    journalling_symbol_tablet journal =
+      journalling_symbol_tablet::wrap(model.symbol_table);
+    change_model(journal, model);
+
+    {
+      std::ofstream out(delta_file(), std::ios::binary);
+      REQUIRE_FALSE(write_goto_binary_delta(
+        out, base_file(), base, journal, model.goto_functions));
+    }
+
+    WHEN("The delta is read")
+    {
+      const auto result = read_goto_binary(delta_file(), null_message_handler);
+
+      THEN("The result is the changed model")
+      {
+        REQUIRE(result.has_value());
+        require_changed_model(*result);
+      }
+    }
+  }
+}
@@ -198,6 +198,118 @@ SCENARIO("string refinement", "[core][solvers][strings][string_refinement]")
       }
     }
 
+    WHEN(
+      "length1 == 10 and 'b' == string_char_at({length1, pointer1}, 9) "
+      "is solved before adding 'c' == string_char_at({length1, pointer1}, 3)")
+    {
+      solver.set_to(equal_exprt{length1, from_integer(10, int_type)}, true);
+
+      solver.set_to(
+        equal_exprt{
+          from_integer('b', char_type),
+          function_application_exprt{
+            char_at_function,
+            std::vector<exprt>{string_expr, from_integer(9, int_type)}}},
+        true);
+
+      REQUIRE(
+        solver.dec_solve() == decision_proceduret::resultt::D_SATISFIABLE);
+
+      solver.set_to(
+        equal_exprt{
+          from_integer('c', char_type),
+          function_application_exprt{
+            char_at_function,
+            std::vector<exprt>{string_expr, from_integer(3, int_type)}}},
+        true);
+
+      THEN(
+        "The second call is satisfiable and the model of the array keeps 'b' "
+        "at position 9 and has 'c' at position 3")
+      {
+        auto result = solver.dec_solve();
+        REQUIRE(result == decision_proceduret::resultt::D_SATISFIABLE);
+        const exprt array_model = solver.get(array1);
+        REQUIRE(can_cast_expr<array_exprt>(array_model));
+        const std::vector<exprt> &elements =
+          to_array_expr(array_model).operands();
+        REQUIRE(elements.size() == 10);
+        REQUIRE(elements[3].is_constant());
+        REQUIRE(numeric_cast_v<char>(to_constant_expr(elements[3])) == 'c');
+        REQUIRE(elements[9].is_constant());
+        REQUIRE(numeric_cast_v<char>(to_constant_expr(elements[9])) == 'b');
+      }
+    }
+
+    WHEN(
+      "string_equal({length1, pointer1}, {length2, pointer2}) with no "
+      "constraint on the characters is solved before adding length1 == 3 and "
+      "'b' == string_char_at({length1, pointer1}, 2)")
+    {
+      const symbol_exprt array2{"array2", char_array_type};
+      const symbol_exprt pointer2{"pointer2", pointer_type(char_type)};
+      const symbol_exprt length2{"length2", int_type};
+      const refined_string_exprt string_expr2{length2, pointer2, string_type};
+      solver.set_to(
+        equal_exprt{
+          return_code1,
+          function_application_exprt{associate_array_to_pointer,
+                                     std::vector<exprt>{array2, pointer2}}},
+        true);
+      solver.set_to(
+        equal_exprt{
+          return_code1,
+          function_application_exprt{associate_length_to_array,
+                                     std::vector<exprt>{array2, length2}}},
+        true);
+
+      // equal_function : (string, string) -> bool
+      const symbol_exprt equal_function{
+        ID_cprover_string_equal_func,
+        mathematical_function_typet{{string_type, string_type}, bool_typet{}}};
+      const symbol_exprt equal_result{"equal_result", bool_typet{}};
+      solver.set_to(
+        equal_exprt{equal_result,
+                    function_application_exprt{
+                      equal_function,
+                      std::vector<exprt>{string_expr, string_expr2}}},
+        true);
+      solver.set_to(equal_result, true);
+      solver.set_to(
+        binary_relation_exprt{length1, ID_le, from_integer(10, int_type)},
+        true);
+
+      // No character of either array is constrained, so both get the same
+      // default characters and the universal axiom of string_equal holds
+      // without any index set
+      REQUIRE(
+        solver.dec_solve() == decision_proceduret::resultt::D_SATISFIABLE);
+
+      solver.set_to(equal_exprt{length1, from_integer(3, int_type)}, true);
+      solver.set_to(
+        equal_exprt{
+          from_integer('b', char_type),
+          function_application_exprt{
+            char_at_function,
+            std::vector<exprt>{string_expr, from_integer(2, int_type)}}},
+        true);
+
+      THEN(
+        "The second call instantiates the axiom of the first one and the "
+        "model of array2 has length 3 and 'b' at position 2")
+      {
+        auto result = solver.dec_solve();
+        REQUIRE(result == decision_proceduret::resultt::D_SATISFIABLE);
+        const exprt array_model = solver.get(array2);
+        REQUIRE(can_cast_expr<array_exprt>(array_model));
+        const std::vector<exprt> &elements =
+          to_array_expr(array_model).operands();
+        REQUIRE(elements.size() == 3);
+        REQUIRE(elements[2].is_constant());
+        REQUIRE(numeric_cast_v<char>(to_constant_expr(elements[2])) == 'b');
+      }
+    }
+
     WHEN(
       "g1 => 'b' == string_char_at({length1, pointer1}, 9)"
       " and g2 => 'c' == string_char_at({length1, pointer1}, 9) "